@@ -33,6 +33,32 @@ file AND OR the end of the file.
 
 #include <stdlib.h>
 #include <math.h>
+#include <stddef.h>
+#include <string.h>
+
+// Threads are opt-in, define JUBI_ENABLE_THREADS before including Jubi for the built-in thread pool. Without it Jubi stays free of OS dependencies.
+
+#ifdef JUBI_ENABLE_THREADS
+    #if defined(_WIN32)
+        #include <windows.h>
+    #else
+        #include <pthread.h>
+    #endif
+#endif
+
+// SIMD, used by the JVector2_*Array functions. Define JUBI_NO_SIMD to force the plain C paths, & JUBI_FAST_RSQRT to trade a few bits of precision in JVector2_NormalizeArray for speed.
+
+#ifndef JUBI_NO_SIMD
+    #if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+        #include <xmmintrin.h>
+
+        #define JUBI_SIMD_SSE
+    #elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+        #include <arm_neon.h>
+
+        #define JUBI_SIMD_NEON
+    #endif
+#endif
 
 #ifdef __cplusplus
     extern "C" {
@@ -44,6 +70,48 @@ file AND OR the end of the file.
 
 #define JUBI_MAX_BODIES 1024
 #define JUBI_MAX_SHAPES 2048
+#define JUBI_MAX_POLYGONS 256
+#define JUBI_MAX_POLYGON_VERTICES 8
+
+#define JUBI_MAX_FORCE_FIELDS 32
+
+#define JUBI_MAX_JOINTS 1024
+#define JUBI_MAX_JOINT_COLORS 32 // Joints beyond this many colors on one body are solved serially
+#define JUBI_JOINT_ITERATIONS 2 // Default for WORLD -> JointIterations
+#define JUBI_JOINT_SUBSTEPS 8 // Default for WORLD -> JointSubsteps
+#define JUBI_JOINT_TASK_SIZE 64 // Joints per scheduler task
+
+#define JUBI_MAX_TILEMAPS 8
+
+#define JUBI_PARTICLE_TASK_SIZE 16384 // Particles per scheduler task
+#define JUBI_PARTICLE_RESTITUTION 0.3f // Default for WORLD -> Particles.Restitution
+
+#define JUBI_MAX_OBSERVERS 16
+#define JUBI_STREAM_HYSTERESIS 1.1f // Bodies unload this far past the load radius
+
+#define JUBI_MAX_LOD_TIERS 4 // Stepped every 1, 2, 4 & 8 steps
+
+#define JUBI_MAX_QUEUED_FORCES 1024 // Per world, between steps
+
+#define JUBI_RECORDER_KEYFRAMES 4
+
+#define JUBI_INVALID_HANDLE -1
+
+#define JUBI_CONTACT_SLOP_3D 0.005f // Penetration the 3D resolver leaves alone, so resting contacts don't jitter
+#define JUBI_CONTACT_CORRECTION_3D 0.8f // Share of the rest it corrects each step
+#define JUBI_SOLVER_ITERATIONS_3D 8 // Default for WORLD -> SolverIterations in 3D worlds
+
+// Step features, pass a subset to Jubi_StepWorld2DEx to skip whole phases of the step. Jubi_StepWorld2D runs them all.
+
+#define JUBI_STEP_FORCE_FIELDS (1u << 0)
+#define JUBI_STEP_CONTINUOUS (1u << 1) // Bullet CCD
+#define JUBI_STEP_POLYGONS (1u << 2) // Polygon narrowphase, without it every pair is resolved as AABBs
+#define JUBI_STEP_JOINTS (1u << 3)
+#define JUBI_STEP_TILEMAPS (1u << 4)
+#define JUBI_STEP_PARTICLES (1u << 5)
+#define JUBI_STEP_STREAMING (1u << 6) // Freezing & unloading bodies far from every observer
+#define JUBI_STEP_LOD (1u << 7) // Stepping bodies far from every observer less often
+#define JUBI_STEP_ALL 0xFFFFFFFFu
 
 #define GRAVITY 9.81f
 #define AIR_RESISTANCE 0.01f
@@ -66,6 +134,56 @@ file AND OR the end of the file.
 
 #define PI 3.14159265358979323846
 
+// Allocation, define all three before including Jubi to route Jubi's heap use through your own allocator.
+
+#ifndef JUBI_MALLOC
+    #define JUBI_MALLOC(SIZE) malloc(SIZE)
+    #define JUBI_REALLOC(POINTER, SIZE) realloc((POINTER), (SIZE))
+    #define JUBI_FREE(POINTER) free(POINTER)
+#endif
+
+#define JUBI_ARENA_ALIGNMENT 16
+
+// Atomics, used for lock-free hand-off between the simulation thread & reader threads.
+
+#if defined(_MSC_VER)
+    #include <intrin.h>
+
+    #define JUBI_ATOMIC_EXCHANGE(PTR, VALUE) _InterlockedExchange((volatile long *)(PTR), (long)(VALUE))
+    #define JUBI_ATOMIC_LOAD(PTR) _InterlockedOr((volatile long *)(PTR), 0)
+    #define JUBI_ATOMIC_ADD(PTR, VALUE) _InterlockedExchangeAdd((volatile long *)(PTR), (long)(VALUE))
+#else
+    #define JUBI_ATOMIC_EXCHANGE(PTR, VALUE) __atomic_exchange_n((PTR), (VALUE), __ATOMIC_ACQ_REL)
+    #define JUBI_ATOMIC_LOAD(PTR) __atomic_load_n((PTR), __ATOMIC_ACQUIRE)
+    #define JUBI_ATOMIC_ADD(PTR, VALUE) __atomic_fetch_add((PTR), (VALUE), __ATOMIC_ACQ_REL) // Returns the value before the add
+#endif
+
+// Jubi's global state (the error system) is per thread, so worlds can be stepped on different threads at once.
+
+#if defined(__cplusplus) && __cplusplus >= 201103L
+    #define JUBI_THREAD_LOCAL thread_local
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+    #define JUBI_THREAD_LOCAL _Thread_local
+#elif defined(_MSC_VER)
+    #define JUBI_THREAD_LOCAL __declspec(thread)
+#elif defined(__GNUC__) || defined(__clang__)
+    #define JUBI_THREAD_LOCAL __thread
+#else
+    #define JUBI_THREAD_LOCAL
+#endif
+
+#define JUBI_MAX_THREADS 64
+
+// Forces a function to be inlined, so calls with constant arguments get specialized
+
+#if defined(_MSC_VER)
+    #define JUBI_FORCE_INLINE __forceinline
+#elif defined(__GNUC__) || defined(__clang__)
+    #define JUBI_FORCE_INLINE inline __attribute__((always_inline))
+#else
+    #define JUBI_FORCE_INLINE inline
+#endif
+
 // GUARDRAILS
 
 // All 'MAX' values in this guardrail section, are different from limiters like max bodies, as those are for preventing lots of data to be ran continuously. Things below like the max velocity is to prevent glitching internally when velocity exceeds a certain point.
@@ -75,10 +193,15 @@ file AND OR the end of the file.
 #define JUBI_GUARD_MINIMUM_DELTA_TIME 0.001f
 #define JUBI_GUARD_MAX_DELTA_TIME 0.066f
 
+// Continuous collision (bullets)
+
+#define JUBI_MAX_CCD_ITERATIONS 4 // Impacts handled per bullet per step before the remaining motion is dropped
+#define JUBI_CCD_SKIN 0.001f // Distance a bullet is held back from the surface it hits
+
 // Internal Variables
 
-static JUBI_UINT64 Jubi_GT = 0;
-static JUBI_UINT64 Jubi_ErrorTick = 0;
+static JUBI_THREAD_LOCAL JUBI_UINT64 Jubi_GT = 0;
+static JUBI_THREAD_LOCAL JUBI_UINT64 Jubi_ErrorTick = 0;
 
 // Struct(s)
 
@@ -115,14 +238,25 @@ typedef struct {
 
 typedef enum {
     SHAPE_CIRCLE,
-    SHAPE_BOX
+    SHAPE_BOX,
+    SHAPE_POLYGON // Convex, only through the world's shape pool (Jubi_CreatePolygonShape2D)
 } Shape2D;
 
 typedef enum {
     BODY_STATIC,
-    BODY_DYNAMIC
+    BODY_DYNAMIC,
+    BODY_KINEMATIC // Moved only by its Velocity (platforms, elevators), pushes dynamic bodies but is never pushed back. 3D worlds treat it as static.
 } BodyType2D;
 
+// Body Flags
+
+#define JUBI_BODY_BULLET (1u << 0) // Swept against other bodies each step so it can't tunnel through them
+#define JUBI_BODY_FROZEN (1u << 1) // Set by streaming, the body holds still like a static body until an observer comes close
+#define JUBI_BODY_WAITING (1u << 2) // Set by level of detail on steps the body's tier skips, it holds still like a frozen body
+#define JUBI_BODY_SENSOR (1u << 3) // Only reports what it overlaps (World.SensorOverlaps), it's never resolved & never pushes anything
+
+#define JUBI_BODY_HELD (JUBI_BODY_FROZEN | JUBI_BODY_WAITING) // Not moved by this step
+
 typedef struct {
     float x;
     float y;
@@ -140,6 +274,35 @@ typedef struct {
     float Radius;
 } Circle2D;
 
+// Convex polygon in local space, wound counter-clockwise, with each edge's outward normal precomputed. Normals[i] belongs to the edge Vertices[i] -> Vertices[i + 1].
+typedef struct {
+    Vector2 Vertices[JUBI_MAX_POLYGON_VERTICES];
+    Vector2 Normals[JUBI_MAX_POLYGON_VERTICES];
+    int Count;
+} JubiPolygon2D;
+
+typedef struct {
+    Vector2 Normal; // Points from A towards B
+    float Depth; // Deepest penetration along Normal
+
+    Vector2 Points[2];
+    int PointCount;
+} JubiManifold2D;
+
+// Shared Shapes
+
+// Local-space geometry stored once per world & referenced by id, so thousands of identical bodies share one copy.
+
+typedef struct {
+    Shape2D Type;
+
+    Vector2 Size;
+    Vector2 HalfSize; // Precomputed, a body's bounds are just Position + Offset +/- HalfSize
+    Vector2 Offset; // Center of the local bounds, only polygons can be off-center
+
+    int PolygonId; // SHAPE_POLYGON only, index into WORLD -> Polygons
+} JubiShape2D;
+
 // Forward Declarations
 
 typedef struct JubiWorld2D JubiWorld2D;
@@ -161,32 +324,536 @@ typedef struct {
     float Restitution;
     float Friction;
 
-    union {
-        AABB _AABB;
-        Circle2D Circle;
-    } ShapeData;
+    AABB Bounds; // Rebuilt from Position & the shared shape (or _Size without one), circles use _Size.x as their diameter
+
+    JUBI_UINT32 Flags; // JUBI_BODY_* bits
+
+    int Tier; // Level of detail tier, the body is stepped every 2^Tier steps
+    float _Skipped; // Time from steps its tier skipped, made up on its next step
+    int _ContactTier; // Tier + 1 of the fastest body it touched last step, 0 for none
 
-    AABB Bounds;
+    int ShapeId; // Shared shape in WORLD -> Shapes that its bounds & polygon come from (-1 if the body only uses its own _Size)
 
     int Index; // Index in world (-1 if raw)
+    int Handle; // Stable handle in world, unlike Index it survives other bodies being removed (-1 if raw)
     JubiWorld2D *WORLD;
+
+    void *UserData; // Never touched by Jubi, follows the body through streaming when its handle doesn't
 } Body2D;
 
+// Bulk Creation
+
+typedef struct {
+    const Vector2 *Positions; // Required
+    const Vector2 *Sizes; // Required
+    const float *Masses; // Optional, 1.0f for every body when NULL
+    const Shape2D *Shapes; // Optional, SHAPE_BOX for every body when NULL
+    const BodyType2D *Types; // Optional, BODY_DYNAMIC for every body when NULL
+    const int *ShapeIds; // Optional, shared shapes from Jubi_CreateShape2D, replaces Sizes & Shapes when set
+} JubiBodyBatch2D;
+
+typedef struct {
+    int First; // Index of the first body created (-1 on failure)
+    int Count;
+} JubiBodyRange2D;
+
+// Force Fields
+
+typedef enum {
+    FIELD_DIRECTIONAL, // The same force on every body it touches (wind)
+    FIELD_RADIAL, // Pushes away from Center, falling off to nothing at Radius (explosions)
+    FIELD_ATTRACTOR // Pulls towards Center, falling off to nothing at Radius
+} ForceFieldType2D;
+
+typedef struct {
+    ForceFieldType2D Type;
+
+    Vector2 Force; // FIELD_DIRECTIONAL only
+    Vector2 Center;
+    float Radius;
+    float Strength; // Force at Center for radial fields & attractors
+
+    AABB Region; // Bodies outside of this are untouched, when HasRegion is set
+    int HasRegion;
+
+    int Impulse; // Applied once as an impulse on the next step, then removed
+    int Active;
+} JubiForceField2D;
+
+// Joints
+
+typedef enum {
+    JOINT_DISTANCE, // Keeps the anchors Length apart
+    JOINT_REVOLUTE, // Pins the anchors together (bodies don't rotate yet, so this only holds position)
+    JOINT_WELD // Locks the offset between the bodies
+} JointType2D;
+
+typedef struct {
+    JointType2D Type;
+
+    int BodyA; // Body handles
+    int BodyB;
+
+    Vector2 AnchorA; // Offsets from each body's position
+    Vector2 AnchorB;
+
+    float Length; // JOINT_DISTANCE only, measured from the bodies when added if negative
+    float Stiffness; // 1 is rigid, lower lets the joint stretch & spring back
+
+    int Active;
+} JubiJoint2D;
+
+// Tilemaps
+
+// A static grid of tiles, one byte each instead of a whole static body per tile. Tile (0, 0) has its top left corner at Origin, X runs right & Y runs down (the same way as gravity).
+typedef struct {
+    JUBI_UINT8 *Tiles; // Width * Height, row by row, nonzero is solid. NULL while the slot is free
+    int Width;
+    int Height;
+
+    float TileSize;
+    Vector2 Origin;
+} JubiTilemap2D;
+
+// Particles
+
+// Lightweight points for debris, sparks etc, kept apart from bodies as plain arrays (structure of arrays) so they can be stepped in bulk. They fall with the world's Gravity & air resistance & bounce off static bodies & tilemaps, but never touch each other or dynamic bodies.
+typedef struct {
+    float *X;
+    float *Y;
+    float *VX;
+    float *VY;
+    float *Life; // Seconds left, INFINITY for particles that live until killed
+
+    int Count;
+    int Capacity;
+
+    float Restitution; // How much speed a particle keeps bouncing off the world
+
+    int _Mortal; // Some particle has a finite life, so dead ones need sweeping
+} JubiParticles2D;
+
+// Streaming
+
+// Bodies unloaded from the world, stored by the square of the map they were in
+typedef struct {
+    int X;
+    int Y;
+
+    Body2D *Bodies;
+    int Count;
+    int Capacity;
+
+    AABB Bounds; // Around every stored body, so chunks with nothing near an observer are skipped without looking at their bodies
+} JubiChunk2D;
+
+// Only the area around the world's observers is simulated. Further out bodies are frozen, & past the load radius they're taken out of the world entirely & kept in chunks until an observer comes back, so a map can hold far more than JUBI_MAX_BODIES.
+typedef struct {
+    int Enabled;
+
+    float ChunkSize;
+    float ActiveRadius; // Bodies closer than this to an observer are simulated
+    float LoadRadius; // Bodies closer than this are kept in the world, frozen past ActiveRadius
+
+    // Called with LOADED = 0 just before a body is unloaded (while its handle is still valid) & LOADED = 1 after it's back in the world. Loaded bodies get a new handle, so use UserData to recognize them.
+    void (*OnStream)(void *CONTEXT, Body2D *BODY, int LOADED);
+    void *Context;
+
+    // Counts from the last step
+    int Active;
+    int Frozen;
+    int Unloaded;
+
+    JubiChunk2D *_Chunks;
+    int _ChunkCount;
+    int _ChunkCapacity;
+} JubiStreaming2D;
+
+// Level of Detail
+
+typedef struct {
+    float Distances[JUBI_MAX_LOD_TIERS - 1]; // Distance from the nearest observer where tier i + 1 starts
+    int TierCount; // 1 steps every body every step
+
+    int Counts[JUBI_MAX_LOD_TIERS]; // Dynamic bodies in each tier on the last step
+} JubiLOD2D;
+
+// Scratch Arena
+
+// Linear allocator for data that only lives for one step (pair lists, query results, ...). It's reset at the start of every step, & grown to the largest amount any step has needed, so once a scene settles stepping doesn't touch the heap at all.
+
+typedef struct {
+    unsigned char *Base;
+    size_t Capacity;
+    size_t Offset;
+
+    size_t HighWater; // Most bytes a single step has asked for
+    size_t _Used; // Bytes asked for this step, including overflow
+
+    void *_Overflow; // Heap blocks for whatever didn't fit this step, freed on the next reset
+    int UserOwned; // Base was given by the user, so it's never grown or freed
+} JubiArena;
+
+typedef struct {
+    int A;
+    int B;
+} JubiPair2D;
+
+// Sensors
+
+typedef struct {
+    int Sensor; // Handle of the sensor
+    int Other; // Handle of the body overlapping it
+} JubiSensorOverlap2D;
+
+// Prediction
+
+typedef struct {
+    int Handle; // Body to predict
+    Vector2 *Path; // STEPS positions, written by Jubi_PredictPaths2D
+
+    int HitStep; // First step that ran into static geometry (-1 for none), the path stays where it hit from there on
+} JubiPrediction2D;
+
+// Transform Output
+
+// Render/reader threads shouldn't touch WORLD -> Bodies while a step is running, so every step publishes a compact copy of each body's transform into a triple buffer. The simulation always owns one frame, the reader owns another, and the third is swapped atomically between them, so neither side ever waits.
+
+#define JUBI_TRANSFORM_FRESH 4 // Set on the shared slot when it holds a frame the reader hasn't seen
+
+typedef struct {
+    Vector2 Position;
+    float Rotation; // Reserved, bodies don't rotate yet (always 0)
+
+    int Handle; // Body2D.Handle, to follow a body across frames as indices shift
+} JubiTransform2D;
+
+typedef struct {
+    JubiTransform2D Transforms[JUBI_MAX_BODIES]; // Indexed like WORLD -> Bodies at the time of the step
+    int Count;
+
+    JUBI_UINT64 Step; // WORLD -> StepCount this frame was published on
+} JubiTransformFrame2D;
+
+typedef struct {
+    JubiTransformFrame2D *Frames; // 3 of them, allocated when transform output is first enabled
+
+    long _Shared; // Frame index owned by neither side, plus JUBI_TRANSFORM_FRESH
+    int _Back; // Frame index owned by the simulation
+    int _Front; // Frame index owned by the reader
+
+    long Enabled; // Read atomically by the reader, so output can be switched on after the reader thread has started
+} JubiTransformBuffer2D;
+
+// Async Stepping
+
+typedef struct {
+    int Handle;
+    Vector2 Force;
+} JubiQueuedForce2D;
+
+// Returned by Jubi_StepWorld2DAsync, done once the world has finished that step
+typedef struct {
+    JubiWorld2D *World;
+    long Ticket;
+} JubiStepFence2D;
+
+// Networking
+
+// Sizes of the smallest steps positions & velocities are sent in, e.g. 0.01f for centimetres
+typedef struct {
+    float PositionPrecision;
+    float VelocityPrecision;
+} JubiNetFormat2D;
+
+// One body's state in multiples of the format's precision
+typedef struct {
+    JUBI_INT32 X;
+    JUBI_INT32 Y;
+    JUBI_INT32 VX;
+    JUBI_INT32 VY;
+} JubiNetBody2D;
+
+// Every body's quantized state on one tick, by handle. Both sides keep these as baselines for the next delta.
+typedef struct {
+    JubiNetBody2D Bodies[JUBI_MAX_BODIES];
+    JUBI_UINT8 Present[JUBI_MAX_BODIES];
+
+    JUBI_UINT32 Tick; // WORLD -> StepCount it was taken on
+} JubiSnapshot2D;
+
+// Flight Recorder
+
+typedef enum {
+    RECORD_STEP,
+    RECORD_FORCE,
+    RECORD_IMPULSE,
+    RECORD_ADD,
+    RECORD_REMOVE
+} RecordType2D;
+
+// The world's bodies right before step Step, where replays start from
+typedef struct {
+    JUBI_UINT64 Step;
+    JUBI_UINT64 Start; // Position of its first event in the recorder's stream
+    int Valid; // 0 once its events have been overwritten
+
+    Body2D *Bodies; // JUBI_MAX_BODIES, BodyCount used
+    int BodyCount;
+
+    int HandleToIndex[JUBI_MAX_BODIES];
+    int FreeHandles[JUBI_MAX_BODIES];
+    int FreeHandleCount;
+
+    // The broadphase order decides the order pairs are resolved in, so it's part of the state too
+    int SortedBodies[JUBI_MAX_BODIES];
+    int SortedCount;
+    int BroadphaseDirty;
+    float MaxWidthX;
+} JubiKeyframe2D;
+
+// Ring buffer of everything done to a world's bodies from outside the step (forces, impulses, adds, removes) plus each step's delta time, with keyframes to replay from
+typedef struct {
+    JUBI_UINT8 *Events;
+    size_t Capacity;
+    JUBI_UINT64 Head; // Bytes ever written, the ring position is Head % Capacity
+
+    int KeyframeInterval;
+    JubiKeyframe2D Keyframes[JUBI_RECORDER_KEYFRAMES];
+
+    int _NextKeyframe;
+    JUBI_UINT64 _OldestStart; // Start of the oldest valid keyframe
+    int _Stepping; // Changes made by the step itself aren't inputs
+} JubiRecorder2D;
+
+// Profiling
+
+// Parts of the step, in the order they run. Phases a step skips (disabled features, no bullets, ...) aren't entered.
+typedef enum {
+    JUBI_PHASE_BEGIN, // Recording & resetting the scratch arena
+    JUBI_PHASE_STREAMING,
+    JUBI_PHASE_LOD,
+    JUBI_PHASE_REORDER,
+    JUBI_PHASE_INTEGRATE, // Force fields, integration & joints
+    JUBI_PHASE_BROADPHASE,
+    JUBI_PHASE_CONTINUOUS,
+    JUBI_PHASE_PAIRS, // Sweeping for pairs & reporting sensors
+    JUBI_PHASE_RESOLVE,
+    JUBI_PHASE_TILEMAPS,
+    JUBI_PHASE_PARTICLES,
+    JUBI_PHASE_TRANSFORMS,
+    JUBI_PHASE_END // The step has finished, also the number of phases
+} JubiPhase2D;
+
+// Called as PHASE starts, which is also when the phase before it ended. Runs on whichever thread is stepping the world.
+typedef void (*JubiPhaseHook2D)(void *DATA, JubiPhase2D PHASE);
+
+// Owns heap memory (scratch arena, pools, tilemaps, particles, unloaded bodies), so don't copy one with =, both copies would share it & destroying either frees it under the other. Use Jubi_CloneWorld2D.
 struct JubiWorld2D {
     Body2D Bodies[JUBI_MAX_BODIES];
     
     int BodyCount;
     float Gravity;
 
+    // Handles
+    int _HandleToIndex[JUBI_MAX_BODIES]; // -1 for free handles
+    int _FreeHandles[JUBI_MAX_BODIES];
+    int _FreeHandleCount;
+
+    JUBI_UINT64 StepCount;
+    int ReorderInterval; // Steps between sorting Bodies by Morton code (Jubi_ReorderBodies2D), 0 for never
+
+    // Shapes, polygons, joints & transform frames are allocated the first time they're used (JUBI_MAX_* each), so a world that doesn't use them stays small
+    JubiShape2D *Shapes;
+    int ShapeCount;
+
+    JubiPolygon2D *Polygons;
+    int PolygonCount;
+
+    JubiForceField2D ForceFields[JUBI_MAX_FORCE_FIELDS];
+
+    JubiJoint2D *Joints;
+    int JointIterations; // Solver passes over every joint, per substep
+    int JointSubsteps; // Steps are split into this many substeps while the world has joints
+
+    int _JointOrder[JUBI_MAX_JOINTS]; // Active joint ids, grouped by color
+    int _ColorStart[JUBI_MAX_JOINT_COLORS + 1]; // Where each color starts in _JointOrder
+    int _ColorCount;
+    int _JointsDirty; // Recolor on the next step
+
+    JubiTilemap2D Tilemaps[JUBI_MAX_TILEMAPS];
+
+    JubiParticles2D Particles;
+
+    Vector2 Observers[JUBI_MAX_OBSERVERS]; // Players, cameras etc, set with Jubi_SetObservers2D
+    int ObserverCount;
+
+    JubiStreaming2D Streaming;
+    JubiLOD2D LOD;
+
+    JubiTransformBuffer2D Transforms;
+
+    // Async stepping
+    long _AsyncIssued; // Async steps started, only touched by the thread starting them
+    long _AsyncDone; // Async steps finished, read atomically
+    void *_AsyncWorker; // Background thread, only with JUBI_ENABLE_THREADS
+
+    JubiQueuedForce2D _QueuedForces[JUBI_MAX_QUEUED_FORCES];
+    long _QueuedCount;
+    long _QueueLock;
+
+    JubiRecorder2D *Recorder; // NULL unless Jubi_EnableRecorder2D was called
+
+    JubiPhaseHook2D PhaseHook; // NULL unless Jubi_SetPhaseHook2D was called
+    void *PhaseHookData;
+
+    // Sensors
+    JubiSensorOverlap2D *SensorOverlaps; // Found by the last step, in the scratch arena so only valid until the next step
+    int SensorOverlapCount;
+    int _SensorOverlapCapacity;
+
+    JubiArena Scratch;
+
+    // Broadphase (sort & sweep on X)
+    int _SortedBodies[JUBI_MAX_BODIES]; // Body indices ordered by Bounds.Min.x
+    int _SortedCount;
+    int _BroadphaseDirty;
+    float _MaxWidthX; // Widest Bounds on X, so queries know how far left to start
+
+    int Destroyed; // 0 = Valid, 1 = Destroyed
+};
+
+// 3D World
+
+typedef struct JubiWorld3D JubiWorld3D;
+
+// Padded to 16 bytes so a vector fills exactly one SIMD register, _w is always 0
+typedef struct {
+    float x;
+    float y;
+    float z;
+    float _w;
+} Vector3;
+
+typedef struct {
+    Vector3 Min;
+    Vector3 Max;
+} AABB3D;
+
+typedef enum {
+    SHAPE3D_BOX,
+    SHAPE3D_SPHERE
+} Shape3D;
+
+// Unlike the 2D world there's no body struct, every field is its own array indexed by body (structure of arrays), so the step works through 4 bodies per SIMD instruction & each phase only reads the fields it needs. Bodies are reached by handle through the JBody3D_* functions, indices change when bodies are removed.
+struct JubiWorld3D {
+    float PositionX[JUBI_MAX_BODIES];
+    float PositionY[JUBI_MAX_BODIES];
+    float PositionZ[JUBI_MAX_BODIES];
+
+    float VelocityX[JUBI_MAX_BODIES];
+    float VelocityY[JUBI_MAX_BODIES];
+    float VelocityZ[JUBI_MAX_BODIES];
+
+    // Accumulated until the next step
+    float ForceX[JUBI_MAX_BODIES];
+    float ForceY[JUBI_MAX_BODIES];
+    float ForceZ[JUBI_MAX_BODIES];
+
+    // Half extents, the radius on every axis for spheres
+    float HalfX[JUBI_MAX_BODIES];
+    float HalfY[JUBI_MAX_BODIES];
+    float HalfZ[JUBI_MAX_BODIES];
+
+    float Mass[JUBI_MAX_BODIES];
+    float InvMass[JUBI_MAX_BODIES]; // 0 for static bodies
+    float Restitution[JUBI_MAX_BODIES];
+    float _Moves[JUBI_MAX_BODIES]; // 1 for dynamic bodies & 0 for static ones, so integration doesn't branch
+
+    JUBI_UINT8 Shape[JUBI_MAX_BODIES]; // Shape3D
+    JUBI_UINT8 Type[JUBI_MAX_BODIES]; // BodyType2D
+
+    int Handle[JUBI_MAX_BODIES];
+    void *UserData[JUBI_MAX_BODIES]; // Never touched by Jubi
+
+    int BodyCount;
+    Vector3 Gravity; // Acceleration, {0, GRAVITY, 0} by default (+Y is down, like the 2D world)
+    int SolverIterations; // Passes over every contact per step, stacks need several for weight to reach the bottom
+
+    // Handles
+    int _HandleToIndex[JUBI_MAX_BODIES]; // -1 for free handles
+    int _FreeHandles[JUBI_MAX_BODIES];
+    int _FreeHandleCount;
+
+    JUBI_UINT64 StepCount;
+
+    JubiArena Scratch;
+
+    // Broadphase (sort & sweep on X)
+    float _MinX[JUBI_MAX_BODIES]; // Bounds on X as of the last update
+    float _MaxX[JUBI_MAX_BODIES];
+    int _SortedBodies[JUBI_MAX_BODIES]; // Body indices ordered by _MinX
+    int _SortedCount;
+    int _BroadphaseDirty;
+    float _MaxWidthX;
+
     int Destroyed; // 0 = Valid, 1 = Destroyed
 };
 
+// Scheduling
+
+typedef void (*JubiTaskFunction)(void *DATA, int INDEX);
+
+// Runs TASK(DATA, i) for every i in [0, COUNT), in any order & on any threads, returning once they've all finished
+typedef struct {
+    void (*Run)(void *CONTEXT, JubiTaskFunction TASK, void *DATA, int COUNT);
+    void *Context;
+} JubiScheduler;
+
+#ifdef JUBI_ENABLE_THREADS
+    typedef struct {
+        #if defined(_WIN32)
+            HANDLE Threads[JUBI_MAX_THREADS];
+            SRWLOCK Lock;
+            CONDITION_VARIABLE Wake;
+            CONDITION_VARIABLE Done;
+        #else
+            pthread_t Threads[JUBI_MAX_THREADS];
+            pthread_mutex_t Lock;
+            pthread_cond_t Wake;
+            pthread_cond_t Done;
+        #endif
+
+        int ThreadCount; // Workers, the thread calling Run works too
+
+        // Current job, guarded by Lock apart from _Next
+        JubiTaskFunction _Task;
+        void *_Data;
+        long _Count;
+        long _Next;
+        int _Busy; // Workers still on the current job
+        int _Running; // A job is in progress, Run calls from other threads (async steps) wait their turn
+        JUBI_UINT64 _Generation; // Bumped for every job, so sleeping workers know there's new work
+
+        int _Shutdown;
+    } JubiThreadPool;
+#endif
+
+// Steps many independent worlds in parallel through the scheduler. Worlds are handed out largest (by body count) first, so the big ones don't end up last on a single thread.
+typedef struct {
+    JubiWorld2D **Worlds;
+    int Count;
+
+    int *_Order; // Indices into Worlds, by descending body count
+    float _DeltaTime;
+} JubiWorldGroup2D;
+
 // Jubi Global Helpers
 
 #define JUBI_SUCCESSFUL(Result) ((Result) == JUBI_SUCCESS)
 
 // Internal state of the error system
-static JubiError LAST_ERROR = {
+static JUBI_THREAD_LOCAL JubiError LAST_ERROR = {
     .Code = JUBI_SUCCESS,
     .Function = NULL
 };
@@ -199,6 +866,7 @@ static JubiError LAST_ERROR = {
 
 JubiError Jubi_GetLastError(void);
 JubiResult Jubi_GetLastErrorCode(void);
+JubiResult Jubi_GetWorldError(int WORLD_VALIDITY);
 const char *Jubi_GetErrorMessage(JubiResult Code);
 
 JUBI_UINT64 Jubi_AccumulatedErrors(void);
@@ -217,6 +885,7 @@ static void Jubi__SetError(JubiResult CODE, const char *FUNCTION);
 JubiWorld2D Jubi_CreateWorld2D();
 void Jubi_ClearWorld2D(JubiWorld2D *WORLD);
 void Jubi_DestroyWorld2D(JubiWorld2D *WORLD);
+int Jubi_CloneWorld2D(JubiWorld2D *WORLD, JubiWorld2D *OUT);
 int Jubi_WorldIsDestroyed(JubiWorld2D *WORLD);
 int Jubi_IsWorldValid(JubiWorld2D *WORLD);
 
@@ -224,74 +893,392 @@ int Jubi_GetBodyIndex(JubiWorld2D *WORLD, Body2D *BODY);
 int Jubi_IsBodyInWorld(JubiWorld2D *WORLD, Body2D *BODY);
 int Jubi_AddBodyToWorld(JubiWorld2D *WORLD, Body2D *BODY);
 int Jubi_RemoveBodyFromWorld(JubiWorld2D *WORLD, Body2D *BODY);
+Body2D *Jubi_GetBodyFromHandle2D(JubiWorld2D *WORLD, int HANDLE);
+
+static void Jubi__ResetHandles2D(JubiWorld2D *WORLD);
+static void *Jubi__CopyPool(const void *POOL, size_t SIZE, int *FAILED);
+
+int Jubi_ReorderBodies2D(JubiWorld2D *WORLD);
+
+static JUBI_UINT32 Jubi__Morton2D(JUBI_UINT32 X, JUBI_UINT32 Y);
+static void Jubi__ReorderBodies2D(JubiWorld2D *WORLD);
 
 void Jubi_StepWorld2D(JubiWorld2D *WORLD, float DeltaTime);
+void Jubi_StepWorld2DEx(JubiWorld2D *WORLD, float DeltaTime, JUBI_UINT32 FEATURES);
+int Jubi_SetPhaseHook2D(JubiWorld2D *WORLD, JubiPhaseHook2D HOOK, void *DATA);
 
-// Customization
+static JUBI_FORCE_INLINE void Jubi__StepWorld2D(JubiWorld2D *WORLD, float DeltaTime, JUBI_UINT32 FEATURES);
+static JUBI_FORCE_INLINE void Jubi__EnterPhase2D(JubiWorld2D *WORLD, JubiPhase2D PHASE);
 
-void Jubi_ChangeMaxBodies(int BODYCOUNT);
-void Jubi_ChangeMaxVelocity(float VELOCITY);
+int Jubi_QueryAABB2D(JubiWorld2D *WORLD, AABB AREA, int *OUT, int MAX);
 
-void Jubi_ChangeMinimumDeltaTime(float DELTATIME);
-void Jubi_ChangeMaxDeltaTime(float DELTATIME);
+static void Jubi__UpdateBroadphase2D(JubiWorld2D *WORLD);
+static int Jubi__QueryAABB2D(JubiWorld2D *WORLD, AABB AREA, int *OUT, int MAX);
+static void Jubi__SolveContinuous2D(JubiWorld2D *WORLD, Body2D *BODY, float DeltaTime, int *CANDIDATES);
 
-void Jubi_ChangeWorldGravity(JubiWorld2D *WORLD, float _GRAVITY);
+// Shared Shapes
 
-// Vector2 Math
+int Jubi_CreateShape2D(JubiWorld2D *WORLD, Shape2D Shape, Vector2 Size);
+int Jubi_CreatePolygonShape2D(JubiWorld2D *WORLD, const Vector2 *VERTICES, int COUNT);
 
-Vector2 JVector2_Add(Vector2 A, Vector2 B);
-Vector2 JVector2_Subtract(Vector2 A, Vector2 B);
-Vector2 JVector2_Multiply(Vector2 A, Vector2 B);
-Vector2 JVector2_Divide(Vector2 A, Vector2 B);
+// Force Fields
 
-Vector2 JVector2_Scale(Vector2 A, float Scalar);
-float JVector2_Dot(Vector2 A, Vector2 B);
-float JVector2_Cross(Vector2 A, Vector2 B);
-Vector2 JVector2_Normalize(Vector2 A);
+JubiForceField2D JForceField2D_Directional(Vector2 FORCE);
+JubiForceField2D JForceField2D_Radial(Vector2 CENTER, float RADIUS, float STRENGTH);
+JubiForceField2D JForceField2D_Explosion(Vector2 CENTER, float RADIUS, float STRENGTH);
+JubiForceField2D JForceField2D_Attractor(Vector2 CENTER, float RADIUS, float STRENGTH);
+void JForceField2D_SetRegion(JubiForceField2D *FIELD, AABB REGION);
 
-float JVector2_Length(Vector2 A);
-float JVector2_Distance(Vector2 A, Vector2 B);
-Vector2 JVector2_Direction(Vector2 A, Vector2 B);
+int Jubi_AddForceField2D(JubiWorld2D *WORLD, JubiForceField2D FIELD);
+int Jubi_RemoveForceField2D(JubiWorld2D *WORLD, int ID);
 
-Vector2 JVector_Project(Vector2 A, Vector2 B);
-Vector2 JVector2_Reflect(Vector2 A, Vector2 NORMAL);
-Vector2 JVector2_Perpendicular(Vector2 A);
+static Vector2 Jubi__ApplyForceFields2D(JubiWorld2D *WORLD);
 
-float JClamp(float Value, float MIN, float MAX);
+// Joints
 
-// Vector2 Initializers
+JubiJoint2D JJoint2D_Distance(int BodyA, int BodyB, Vector2 AnchorA, Vector2 AnchorB, float Length);
+JubiJoint2D JJoint2D_Revolute(int BodyA, int BodyB, Vector2 AnchorA, Vector2 AnchorB);
+JubiJoint2D JJoint2D_Weld(int BodyA, int BodyB);
 
-Body2D JBody2D_Init(Vector2 Position, Vector2 Size, Shape2D Shape, BodyType2D Type, float Mass);
-Body2D *JBody2D_CreateBox(JubiWorld2D *WORLD, Vector2 Position, Vector2 Size, BodyType2D Type, float Mass);
-Body2D *JBody2D_CreateCircle(JubiWorld2D *WORLD, Vector2 Position, Vector2 Size, BodyType2D Type, float Mass);
+int Jubi_AddJoint2D(JubiWorld2D *WORLD, JubiJoint2D JOINT);
+int Jubi_RemoveJoint2D(JubiWorld2D *WORLD, int ID);
 
-// Vector2 Physics
+static Body2D *Jubi__JointBody2D(JubiWorld2D *WORLD, int HANDLE);
+static void Jubi__DetachJoints2D(JubiWorld2D *WORLD);
+static void Jubi__ColorJoints2D(JubiWorld2D *WORLD);
+static void Jubi__SolveJoint2D(JubiWorld2D *WORLD, JubiJoint2D *JOINT, float InvDeltaTime);
+static void Jubi__SolveJointTask2D(void *DATA, int INDEX);
+static void Jubi__SolveJoints2D(JubiWorld2D *WORLD, float DeltaTime);
 
-void JBody2D_ApplyForce(Body2D *BODY, Vector2 FORCE);
-void JBody2D_ApplyImpulse(Body2D *BODY, Vector2 IMPULSE);
-Vector2 JVector2_ApplyGravity(Body2D *Body, float DeltaTime);
+// Tilemaps
 
-void Jubi_IntegrateBody(Body2D *BODY, float DeltaTime, float Gravity);
-void Jubi_StepBody2D(Body2D *BODY, float DeltaTime, float Gravity);
+int Jubi_CreateTilemap2D(JubiWorld2D *WORLD, int WIDTH, int HEIGHT, float TILE_SIZE, Vector2 ORIGIN);
+int Jubi_DestroyTilemap2D(JubiWorld2D *WORLD, int ID);
 
-// Vector2 Collision Detection
+int Jubi_SetTile2D(JubiWorld2D *WORLD, int ID, int X, int Y, JUBI_UINT8 VALUE);
+int Jubi_GetTile2D(JubiWorld2D *WORLD, int ID, int X, int Y);
+int Jubi_SetTiles2D(JubiWorld2D *WORLD, int ID, const JUBI_UINT8 *TILES);
 
-int JCollision_AABBvsAABB(const AABB A, const AABB B);
-int JCollision_CirclevsCircle(Circle2D A, Circle2D B);
-int JCollision_AABBvsCircle(AABB A, Circle2D B);
+static JubiTilemap2D *Jubi__GetTilemap2D(JubiWorld2D *WORLD, int ID, const char *FUNCTION);
+static void Jubi__FreeTilemaps2D(JubiWorld2D *WORLD);
+static int Jubi__TileSolid2D(const JubiTilemap2D *MAP, int X, int Y);
+static void Jubi__CollideTilemap2D(const JubiTilemap2D *MAP, Body2D *BODY);
+static void Jubi__CollideTilemaps2D(JubiWorld2D *WORLD);
 
-void JCollision_ResolveAABBvsAABB(Body2D *A, Body2D *B);
+// Particles
 
-#ifdef JUBI_IMPLEMENTATION
-    // Implementation
+int Jubi_ReserveParticles2D(JubiWorld2D *WORLD, int CAPACITY);
+int Jubi_EmitParticles2D(JubiWorld2D *WORLD, const Vector2 *POSITIONS, const Vector2 *VELOCITIES, int COUNT, float LIFETIME);
+int Jubi_KillParticles2D(JubiWorld2D *WORLD, const int *INDICES, int COUNT);
+void Jubi_ClearParticles2D(JubiWorld2D *WORLD);
 
-    JubiWorld2D Jubi_CreateWorld2D() {
-        JubiWorld2D WORLD;
+static int Jubi__GrowParticles2D(JubiParticles2D *PARTICLES, int CAPACITY);
+static void Jubi__FreeParticles2D(JubiParticles2D *PARTICLES);
+static void Jubi__CompactParticles2D(JubiParticles2D *PARTICLES);
+static void Jubi__StepParticleTask2D(void *DATA, int INDEX);
+static void Jubi__StepParticles2D(JubiWorld2D *WORLD, float DeltaTime);
+
+// Streaming
+
+int Jubi_EnableStreaming2D(JubiWorld2D *WORLD, float CHUNK_SIZE, float ACTIVE_RADIUS, float LOAD_RADIUS);
+int Jubi_DisableStreaming2D(JubiWorld2D *WORLD);
+int Jubi_SetObservers2D(JubiWorld2D *WORLD, const Vector2 *POSITIONS, int COUNT);
+int Jubi_StreamBody2D(JubiWorld2D *WORLD, const Body2D *BODY);
+
+static float Jubi__ObserverDistanceSq2D(const JubiWorld2D *WORLD, AABB AREA);
+static int Jubi__StoreBody2D(JubiWorld2D *WORLD, const Body2D *BODY);
+static void Jubi__LoadChunk2D(JubiWorld2D *WORLD, int C);
+static void Jubi__GrowBounds2D(AABB *BOUNDS, AABB OTHER);
+static void Jubi__FreeChunks2D(JubiStreaming2D *STREAMING);
+static void Jubi__UpdateStreaming2D(JubiWorld2D *WORLD);
+static void Jubi__ResolvePair2D(Body2D *A, Body2D *B, JUBI_UINT32 FEATURES);
+
+// Level of Detail
+
+int Jubi_SetLODTiers2D(JubiWorld2D *WORLD, const float *DISTANCES, int COUNT);
+
+static void Jubi__UpdateLOD2D(JubiWorld2D *WORLD, float DeltaTime);
+static void Jubi__PromoteContact2D(Body2D *A, Body2D *B);
+
+// Sensors
+
+static int Jubi__SensorOverlaps2D(const Body2D *A, const Body2D *B);
+static void Jubi__AddSensorOverlap2D(JubiWorld2D *WORLD, const Body2D *A, const Body2D *B);
+
+// Prediction
+
+int Jubi_PredictPaths2D(JubiWorld2D *WORLD, JubiPrediction2D *PREDICTIONS, int COUNT, float DeltaTime, int STEPS, int COLLIDE);
+
+static int Jubi__SweepStatic2D(AABB FROM, Vector2 DISPLACEMENT, AABB STATIC, float *TOI);
+
+// Async Stepping
+
+JubiStepFence2D Jubi_StepWorld2DAsync(JubiWorld2D *WORLD, float DeltaTime);
+int Jubi_PollStep2D(JubiStepFence2D FENCE);
+void Jubi_WaitStep2D(JubiStepFence2D FENCE);
+int Jubi_QueueForce2D(JubiWorld2D *WORLD, int HANDLE, Vector2 FORCE);
+
+static void Jubi__FinishAsync2D(JubiWorld2D *WORLD);
+static void Jubi__ApplyQueuedForces2D(JubiWorld2D *WORLD);
+static void Jubi__FreeAsync2D(JubiWorld2D *WORLD);
+
+// Networking
+
+int Jubi_EncodeSnapshot2D(JubiWorld2D *WORLD, const JubiNetFormat2D *FORMAT, const JubiSnapshot2D *BASELINE, JubiSnapshot2D *CURRENT, JUBI_UINT8 *OUT, int CAPACITY);
+int Jubi_DecodeSnapshot2D(const JUBI_UINT8 *DATA, int SIZE, const JubiSnapshot2D *BASELINE, JubiSnapshot2D *OUT);
+int Jubi_ApplySnapshot2D(JubiWorld2D *WORLD, const JubiNetFormat2D *FORMAT, const JubiSnapshot2D *SNAPSHOT);
+
+static JUBI_INT32 Jubi__Quantize(float VALUE, float INV_PRECISION);
+
+// Flight Recorder
+
+int Jubi_EnableRecorder2D(JubiWorld2D *WORLD, size_t BYTES, int KEYFRAME_INTERVAL);
+void Jubi_DisableRecorder2D(JubiWorld2D *WORLD);
+int Jubi_ReplayRecording2D(JubiWorld2D *RECORDED, JubiWorld2D *TARGET, JUBI_UINT64 UNTIL);
+
+static void Jubi__ReadRecord2D(const JubiRecorder2D *RECORDER, JUBI_UINT64 AT, void *OUT, size_t SIZE);
+static void Jubi__WriteRecord2D(JubiRecorder2D *RECORDER, const void *DATA, size_t SIZE);
+static void Jubi__RecordBody2D(const Body2D *BODY, RecordType2D TYPE, Vector2 VALUE);
+static void Jubi__RecordStep2D(JubiWorld2D *WORLD, float DeltaTime, JUBI_UINT32 FEATURES);
+
+// Scratch Arena
+
+void Jubi_SetScratchMemory2D(JubiWorld2D *WORLD, void *MEMORY, size_t SIZE);
+
+static void Jubi__ResetArena(JubiArena *ARENA);
+static void *Jubi__ArenaAlloc(JubiArena *ARENA, size_t SIZE);
+static void Jubi__RewindArena(JubiArena *ARENA, JubiArena MARK);
+static void Jubi__FreeArena(JubiArena *ARENA);
+
+// Transform Output
+
+void Jubi_EnableTransformOutput2D(JubiWorld2D *WORLD, int ENABLED);
+const JubiTransformFrame2D *Jubi_AcquireTransforms2D(JubiWorld2D *WORLD);
+
+static void Jubi__PublishTransforms2D(JubiWorld2D *WORLD);
+
+// Scheduling
+
+void Jubi_SetScheduler(const JubiScheduler *SCHEDULER);
+
+static void Jubi__RunTasks(JubiTaskFunction TASK, void *DATA, int COUNT);
+
+#ifdef JUBI_ENABLE_THREADS
+    JubiThreadPool *Jubi_CreateThreadPool(int THREADS);
+    void Jubi_DestroyThreadPool(JubiThreadPool *POOL);
+    JubiScheduler Jubi_ThreadPoolScheduler(JubiThreadPool *POOL);
+
+    static void Jubi__ThreadPoolRun(void *CONTEXT, JubiTaskFunction TASK, void *DATA, int COUNT);
+#endif
+
+// World Groups
+
+JubiWorldGroup2D Jubi_CreateWorldGroup2D(JubiWorld2D **WORLDS, int COUNT);
+void Jubi_DestroyWorldGroup2D(JubiWorldGroup2D *GROUP);
+void Jubi_StepWorldGroup2D(JubiWorldGroup2D *GROUP, float DeltaTime);
+
+static void Jubi__StepGroupTask2D(void *DATA, int INDEX);
+
+// Customization
+
+void Jubi_ChangeMaxBodies(int BODYCOUNT);
+void Jubi_ChangeMaxVelocity(float VELOCITY);
+
+void Jubi_ChangeMinimumDeltaTime(float DELTATIME);
+void Jubi_ChangeMaxDeltaTime(float DELTATIME);
+
+void Jubi_ChangeWorldGravity(JubiWorld2D *WORLD, float _GRAVITY);
+
+// Vector2 Math
+
+Vector2 JVector2_Add(Vector2 A, Vector2 B);
+Vector2 JVector2_Subtract(Vector2 A, Vector2 B);
+Vector2 JVector2_Multiply(Vector2 A, Vector2 B);
+Vector2 JVector2_Divide(Vector2 A, Vector2 B);
+
+Vector2 JVector2_Scale(Vector2 A, float Scalar);
+float JVector2_Dot(Vector2 A, Vector2 B);
+float JVector2_Cross(Vector2 A, Vector2 B);
+Vector2 JVector2_Normalize(Vector2 A);
+
+float JVector2_Length(Vector2 A);
+float JVector2_Distance(Vector2 A, Vector2 B);
+Vector2 JVector2_Direction(Vector2 A, Vector2 B);
+
+Vector2 JVector_Project(Vector2 A, Vector2 B);
+Vector2 JVector2_Reflect(Vector2 A, Vector2 NORMAL);
+Vector2 JVector2_Perpendicular(Vector2 A);
+
+// Vector2 Arrays
+
+void JVector2_AddArray(const Vector2 *A, const Vector2 *B, Vector2 *OUT, int COUNT);
+void JVector2_SubtractArray(const Vector2 *A, const Vector2 *B, Vector2 *OUT, int COUNT);
+void JVector2_ScaleArray(const Vector2 *A, float Scalar, Vector2 *OUT, int COUNT);
+void JVector2_DotArray(const Vector2 *A, const Vector2 *B, float *OUT, int COUNT);
+
+void JVector2_LengthArray(const Vector2 *A, float *OUT, int COUNT);
+void JVector2_DistanceArray(const Vector2 *A, const Vector2 *B, float *OUT, int COUNT);
+void JVector2_NormalizeArray(const Vector2 *A, Vector2 *OUT, int COUNT);
+
+float JClamp(float Value, float MIN, float MAX);
+
+// Collision Initializers
+
+AABB JInitialize_AABB(Vector2 Position, Vector2 Size);
+
+// Vector2 Initializers
+
+Body2D JBody2D_Init(Vector2 Position, Vector2 Size, Shape2D Shape, BodyType2D Type, float Mass);
+Body2D *JBody2D_CreateBox(JubiWorld2D *WORLD, Vector2 Position, Vector2 Size, BodyType2D Type, float Mass);
+Body2D *JBody2D_CreateCircle(JubiWorld2D *WORLD, Vector2 Position, Vector2 Size, BodyType2D Type, float Mass);
+Body2D *JBody2D_CreateFromShape(JubiWorld2D *WORLD, Vector2 Position, int ShapeId, BodyType2D Type, float Mass);
+Body2D *JBody2D_CreatePolygon(JubiWorld2D *WORLD, Vector2 Position, const Vector2 *VERTICES, int COUNT, BodyType2D Type, float Mass);
+
+JubiBodyRange2D JBody2D_CreateBatch(JubiWorld2D *WORLD, const JubiBodyBatch2D *BATCH, int COUNT, int *OUT_HANDLES);
+int JBody2D_DestroyBatch(JubiWorld2D *WORLD, const int *HANDLES, int COUNT);
+
+static void Jubi__InitBody2D(Body2D *BODY, Vector2 Position, Vector2 Size, Shape2D Shape, BodyType2D Type, float Mass);
+
+// Vector2 Physics
+
+void JBody2D_ApplyForce(Body2D *BODY, Vector2 FORCE);
+void JBody2D_ApplyImpulse(Body2D *BODY, Vector2 IMPULSE);
+void JBody2D_SetBullet(Body2D *BODY, int ENABLED);
+void JBody2D_SetSensor(Body2D *BODY, int ENABLED);
+Vector2 JVector2_ApplyGravity(Body2D *Body, float DeltaTime);
+
+void Jubi_IntegrateBody(Body2D *BODY, float DeltaTime, float Gravity);
+static void Jubi__IntegrateBody2D(Body2D *BODY, float DeltaTime, Vector2 UniformForce, float Drag);
+static void Jubi__UpdateBounds2D(Body2D *BODY);
+void Jubi_StepBody2D(Body2D *BODY, float DeltaTime, float Gravity);
+
+// Vector2 Collision Detection
+
+int JCollision_AABBvsAABB(const AABB A, const AABB B);
+int JCollision_CirclevsCircle(Circle2D A, Circle2D B);
+int JCollision_AABBvsCircle(AABB A, Circle2D B);
+
+int JPolygon2D_Init(JubiPolygon2D *POLYGON, const Vector2 *VERTICES, int COUNT);
+JubiPolygon2D JPolygon2D_Box(Vector2 HalfSize);
+
+int JCollision_PolygonvsPolygon(const JubiPolygon2D *A, Vector2 POSITION_A, const JubiPolygon2D *B, Vector2 POSITION_B, JubiManifold2D *MANIFOLD);
+int JCollision_PolygonvsCircle(const JubiPolygon2D *A, Vector2 POSITION_A, Circle2D B, JubiManifold2D *MANIFOLD);
+int JCollision_SweepPolygonvsPolygon(const JubiPolygon2D *A, Vector2 POSITION_A, Vector2 DISPLACEMENT, const JubiPolygon2D *B, Vector2 POSITION_B, float *TOI, Vector2 *NORMAL);
+
+int JCollision_SweepAABBvsAABB(AABB A, Vector2 DISPLACEMENT, AABB B, float *TOI, Vector2 *NORMAL);
+int JCollision_SweepCirclevsCircle(Circle2D A, Vector2 DISPLACEMENT, Circle2D B, float *TOI, Vector2 *NORMAL);
+
+void JCollision_ResolveAABBvsAABB(Body2D *A, Body2D *B);
+void JCollision_ResolveManifold(Body2D *A, Body2D *B, const JubiManifold2D *MANIFOLD);
+
+static float Jubi__PolygonSeparation2D(const JubiPolygon2D *A, Vector2 POSITION_A, const JubiPolygon2D *B, Vector2 POSITION_B, int *EDGE);
+static const JubiPolygon2D *Jubi__BodyPolygon2D(const Body2D *BODY, JubiPolygon2D *SCRATCH);
+static int Jubi__CollidePolygonBodies2D(Body2D *A, Body2D *B, JubiManifold2D *MANIFOLD);
+
+// 3D World
+
+JubiWorld3D Jubi_CreateWorld3D();
+void Jubi_ClearWorld3D(JubiWorld3D *WORLD);
+void Jubi_DestroyWorld3D(JubiWorld3D *WORLD);
+int Jubi_IsWorldValid3D(const JubiWorld3D *WORLD);
+
+void Jubi_StepWorld3D(JubiWorld3D *WORLD, float DeltaTime);
+int Jubi_QueryAABB3D(JubiWorld3D *WORLD, AABB3D AREA, int *OUT, int MAX);
+
+int JBody3D_CreateBox(JubiWorld3D *WORLD, Vector3 Position, Vector3 Size, BodyType2D Type, float Mass);
+int JBody3D_CreateSphere(JubiWorld3D *WORLD, Vector3 Position, float Radius, BodyType2D Type, float Mass);
+int JBody3D_Destroy(JubiWorld3D *WORLD, int HANDLE);
+
+int Jubi_GetBodyIndex3D(const JubiWorld3D *WORLD, int HANDLE);
+Vector3 JBody3D_GetPosition(const JubiWorld3D *WORLD, int HANDLE);
+Vector3 JBody3D_GetVelocity(const JubiWorld3D *WORLD, int HANDLE);
+void JBody3D_SetPosition(JubiWorld3D *WORLD, int HANDLE, Vector3 POSITION);
+void JBody3D_SetVelocity(JubiWorld3D *WORLD, int HANDLE, Vector3 VELOCITY);
+void JBody3D_ApplyForce(JubiWorld3D *WORLD, int HANDLE, Vector3 FORCE);
+void JBody3D_ApplyImpulse(JubiWorld3D *WORLD, int HANDLE, Vector3 IMPULSE);
+
+Vector3 JVector3(float x, float y, float z);
+Vector3 JVector3_Add(Vector3 A, Vector3 B);
+Vector3 JVector3_Subtract(Vector3 A, Vector3 B);
+Vector3 JVector3_Scale(Vector3 A, float Scalar);
+float JVector3_Dot(Vector3 A, Vector3 B);
+float JVector3_Length(Vector3 A);
+
+static int Jubi__CreateBody3D(JubiWorld3D *WORLD, Vector3 Position, Vector3 Half, Shape3D Shape, BodyType2D Type, float Mass, const char *FUNCTION);
+static void Jubi__ResetHandles3D(JubiWorld3D *WORLD);
+static void Jubi__IntegrateAxis3D(float *P, float *V, float *F, const float *INV, const float *MOVES, float G, float DT, float DRAG, int COUNT);
+static void Jubi__IntegrateBodies3D(JubiWorld3D *WORLD, float DeltaTime);
+static void Jubi__UpdateBroadphase3D(JubiWorld3D *WORLD);
+static int Jubi__CollidePair3D(const JubiWorld3D *WORLD, int A, int B, Vector3 *NORMAL, float *DEPTH);
+static void Jubi__ResolvePair3D(JubiWorld3D *WORLD, int A, int B);
+
+#ifdef JUBI_IMPLEMENTATION
+    // Implementation
+
+    JubiWorld2D Jubi_CreateWorld2D() {
+        JubiWorld2D WORLD;
 
         WORLD.BodyCount = 0;
         WORLD.Gravity = GRAVITY;
+        WORLD.StepCount = 0;
+        WORLD.ReorderInterval = 0;
+        WORLD.Shapes = NULL;
+        WORLD.ShapeCount = 0;
+        WORLD.Polygons = NULL;
+        WORLD.PolygonCount = 0;
+        WORLD.Joints = NULL;
         WORLD.Destroyed = 0;
 
+        for (int i=0; i < JUBI_MAX_FORCE_FIELDS; i++)
+            WORLD.ForceFields[i].Active = 0;
+
+        WORLD.JointIterations = JUBI_JOINT_ITERATIONS;
+        WORLD.JointSubsteps = JUBI_JOINT_SUBSTEPS;
+        WORLD._ColorStart[0] = 0;
+        WORLD._ColorCount = 0;
+        WORLD._JointsDirty = 0;
+
+        for (int i=0; i < JUBI_MAX_TILEMAPS; i++)
+            WORLD.Tilemaps[i] = (JubiTilemap2D){0};
+
+        WORLD.Particles = (JubiParticles2D){0};
+        WORLD.Particles.Restitution = JUBI_PARTICLE_RESTITUTION;
+
+        WORLD.ObserverCount = 0;
+        WORLD.Streaming = (JubiStreaming2D){0};
+
+        WORLD.LOD = (JubiLOD2D){0};
+        WORLD.LOD.TierCount = 1;
+
+        Jubi__ResetHandles2D(&WORLD);
+
+        WORLD.Transforms.Frames = NULL;
+        WORLD.Transforms._Back = 0;
+        WORLD.Transforms._Shared = 1;
+        WORLD.Transforms._Front = 2;
+        WORLD.Transforms.Enabled = 0;
+
+        WORLD._AsyncIssued = 0;
+        WORLD._AsyncDone = 0;
+        WORLD._AsyncWorker = NULL;
+        WORLD._QueuedCount = 0;
+        WORLD._QueueLock = 0;
+
+        WORLD.Recorder = NULL;
+
+        WORLD.PhaseHook = NULL;
+        WORLD.PhaseHookData = NULL;
+
+        WORLD.SensorOverlaps = NULL;
+        WORLD.SensorOverlapCount = 0;
+        WORLD._SensorOverlapCapacity = 0;
+
+        WORLD.Scratch = (JubiArena){0};
+
+        WORLD._SortedCount = 0;
+        WORLD._BroadphaseDirty = 1;
+        WORLD._MaxWidthX = 0.0f;
+
         return WORLD;
     }
 
@@ -299,20 +1286,212 @@ void JCollision_ResolveAABBvsAABB(Body2D *A, Body2D *B);
         if (WORLD == NULL) return;
         if (WORLD -> Destroyed) return;
 
+        Jubi__FinishAsync2D(WORLD);
+
+        // Nothing before the clear can be replayed into what's after it
+        if (WORLD -> Recorder) {
+            for (int k=0; k < JUBI_RECORDER_KEYFRAMES; k++)
+                WORLD -> Recorder -> Keyframes[k].Valid = 0;
+        }
+
         WORLD -> BodyCount = 0;
+        WORLD -> ShapeCount = 0;
+        WORLD -> PolygonCount = 0;
+
+        // Every joint pointed at a body that's now gone
+        for (int i=0; i < JUBI_MAX_JOINTS && WORLD -> Joints; i++)
+            WORLD -> Joints[i].Active = 0;
+
+        WORLD -> _ColorCount = 0;
+        WORLD -> _JointsDirty = 0;
+
+        Jubi__FreeTilemaps2D(WORLD);
+
+        // Keeps the particle arrays around for the next level
+        WORLD -> Particles.Count = 0;
+        WORLD -> Particles._Mortal = 0;
+
+        // Unloaded bodies go too, the streaming settings stay
+        Jubi__FreeChunks2D(&WORLD -> Streaming);
+
+        WORLD -> SensorOverlaps = NULL;
+        WORLD -> SensorOverlapCount = 0;
+        WORLD -> _SensorOverlapCapacity = 0;
+
+        Jubi__ResetHandles2D(WORLD);
     }
 
     void Jubi_DestroyWorld2D(JubiWorld2D *WORLD) {
         if (WORLD == NULL) return;
         if (WORLD -> Destroyed) return;
 
+        Jubi__FreeAsync2D(WORLD);
+        Jubi_DisableRecorder2D(WORLD);
+
         for (int i=0; i < JUBI_MAX_BODIES; ++i) {
             WORLD -> Bodies[i] = (Body2D){0};
         }
 
         WORLD -> BodyCount = 0;
         WORLD -> Gravity = 0.0f;
+        WORLD -> Transforms.Enabled = 0;
         WORLD -> Destroyed = 1;
+
+        Jubi__FreeArena(&WORLD -> Scratch);
+        Jubi__FreeTilemaps2D(WORLD);
+        Jubi__FreeParticles2D(&WORLD -> Particles);
+        Jubi__FreeChunks2D(&WORLD -> Streaming);
+
+        JUBI_FREE(WORLD -> Shapes);
+        JUBI_FREE(WORLD -> Polygons);
+        JUBI_FREE(WORLD -> Joints);
+        JUBI_FREE(WORLD -> Transforms.Frames);
+
+        WORLD -> Shapes = NULL;
+        WORLD -> Polygons = NULL;
+        WORLD -> Joints = NULL;
+        WORLD -> Transforms.Frames = NULL;
+    }
+
+    // Copies WORLD into OUT with its own pools, tilemaps, particles & unloaded bodies, e.g. to step a copy ahead. OUT is overwritten, so it shouldn't be a live world (destroy it first). The clone starts without a recorder, async worker or scratch memory from Jubi_SetScratchMemory2D, & keeps the phase hook. Returns 1, or -1 if memory ran out (OUT is left destroyed).
+    int Jubi_CloneWorld2D(JubiWorld2D *WORLD, JubiWorld2D *OUT) {
+        Jubi__IncrementErrorTick();
+
+        if (Jubi_IsWorldValid(WORLD) != 1) {
+            Jubi__SetError(Jubi_GetWorldError(Jubi_IsWorldValid(WORLD)), __func__);
+
+            return -1;
+        } else if (OUT == NULL) {
+            Jubi__SetError(JUBI_ERROR_NULL_VALUE, __func__);
+
+            return -1;
+        } else if (OUT == WORLD) {
+            Jubi__SetError(JUBI_ERROR_INVALID_VALUE, __func__);
+
+            return -1;
+        }
+
+        Jubi__FinishAsync2D(WORLD);
+
+        *OUT = *WORLD;
+
+        // Nothing is shared from here on, OUT only owns what's been copied so far so it can be destroyed at any point
+        OUT -> Scratch = (JubiArena){0};
+
+        OUT -> SensorOverlaps = NULL;
+        OUT -> SensorOverlapCount = 0;
+        OUT -> _SensorOverlapCapacity = 0;
+
+        OUT -> Recorder = NULL;
+        OUT -> _AsyncIssued = 0;
+        OUT -> _AsyncDone = 0;
+        OUT -> _AsyncWorker = NULL;
+        OUT -> _QueueLock = 0;
+
+        OUT -> Shapes = NULL;
+        OUT -> Polygons = NULL;
+        OUT -> Joints = NULL;
+        OUT -> Transforms.Frames = NULL;
+
+        for (int i=0; i < JUBI_MAX_TILEMAPS; i++)
+            OUT -> Tilemaps[i].Tiles = NULL;
+
+        OUT -> Particles.X = OUT -> Particles.Y = OUT -> Particles.VX = OUT -> Particles.VY = OUT -> Particles.Life = NULL;
+        OUT -> Particles.Count = 0;
+        OUT -> Particles.Capacity = 0;
+
+        OUT -> Streaming._Chunks = NULL;
+        OUT -> Streaming._ChunkCount = 0;
+        OUT -> Streaming._ChunkCapacity = 0;
+
+        for (int i=0; i < OUT -> BodyCount; i++)
+            OUT -> Bodies[i].WORLD = OUT;
+
+        int FAILED = 0;
+
+        OUT -> Shapes = (JubiShape2D *)Jubi__CopyPool(WORLD -> Shapes, sizeof(JubiShape2D) * JUBI_MAX_SHAPES, &FAILED);
+        OUT -> Polygons = (JubiPolygon2D *)Jubi__CopyPool(WORLD -> Polygons, sizeof(JubiPolygon2D) * JUBI_MAX_POLYGONS, &FAILED);
+        OUT -> Joints = (JubiJoint2D *)Jubi__CopyPool(WORLD -> Joints, sizeof(JubiJoint2D) * JUBI_MAX_JOINTS, &FAILED);
+        OUT -> Transforms.Frames = (JubiTransformFrame2D *)Jubi__CopyPool(WORLD -> Transforms.Frames, sizeof(JubiTransformFrame2D) * 3, &FAILED);
+
+        for (int i=0; i < JUBI_MAX_TILEMAPS && !FAILED; i++) {
+            const JubiTilemap2D *MAP = &WORLD -> Tilemaps[i];
+            if (MAP -> Tiles == NULL) continue;
+
+            size_t SIZE = (size_t)MAP -> Width * (size_t)MAP -> Height;
+
+            OUT -> Tilemaps[i].Tiles = (JUBI_UINT8 *)JUBI_MALLOC(SIZE);
+
+            if (OUT -> Tilemaps[i].Tiles) memcpy(OUT -> Tilemaps[i].Tiles, MAP -> Tiles, SIZE);
+            else FAILED = 1;
+        }
+
+        if (!FAILED && WORLD -> Particles.Capacity > 0) {
+            if (Jubi__GrowParticles2D(&OUT -> Particles, WORLD -> Particles.Capacity)) {
+                size_t SIZE = sizeof(float) * (size_t)WORLD -> Particles.Count;
+
+                memcpy(OUT -> Particles.X, WORLD -> Particles.X, SIZE);
+                memcpy(OUT -> Particles.Y, WORLD -> Particles.Y, SIZE);
+                memcpy(OUT -> Particles.VX, WORLD -> Particles.VX, SIZE);
+                memcpy(OUT -> Particles.VY, WORLD -> Particles.VY, SIZE);
+                memcpy(OUT -> Particles.Life, WORLD -> Particles.Life, SIZE);
+
+                OUT -> Particles.Count = WORLD -> Particles.Count;
+            } else {
+                FAILED = 1;
+            }
+        }
+
+        const JubiStreaming2D *STREAMING = &WORLD -> Streaming;
+
+        if (!FAILED && STREAMING -> _ChunkCount > 0) {
+            OUT -> Streaming._Chunks = (JubiChunk2D *)JUBI_MALLOC(sizeof(JubiChunk2D) * (size_t)STREAMING -> _ChunkCount);
+
+            if (OUT -> Streaming._Chunks) OUT -> Streaming._ChunkCapacity = STREAMING -> _ChunkCount;
+            else FAILED = 1;
+        }
+
+        for (int c=0; c < STREAMING -> _ChunkCount && !FAILED; c++) {
+            const JubiChunk2D *CHUNK = &STREAMING -> _Chunks[c];
+            JubiChunk2D *COPY = &OUT -> Streaming._Chunks[c];
+
+            *COPY = *CHUNK;
+            COPY -> Bodies = NULL;
+            COPY -> Capacity = CHUNK -> Count;
+
+            OUT -> Streaming._ChunkCount++;
+
+            if (CHUNK -> Count > 0) {
+                COPY -> Bodies = (Body2D *)JUBI_MALLOC(sizeof(Body2D) * (size_t)CHUNK -> Count);
+
+                if (COPY -> Bodies) memcpy(COPY -> Bodies, CHUNK -> Bodies, sizeof(Body2D) * (size_t)CHUNK -> Count);
+                else FAILED = 1;
+
+                for (int i=0; i < CHUNK -> Count && !FAILED; i++)
+                    COPY -> Bodies[i].WORLD = OUT;
+            }
+        }
+
+        if (FAILED) {
+            Jubi_DestroyWorld2D(OUT);
+            Jubi__SetError(JUBI_ERROR_WORLD_FULL, __func__);
+
+            return -1;
+        }
+
+        return 1;
+    }
+
+    // NULL pools stay NULL, FAILED is set if a copy can't be allocated
+    static void *Jubi__CopyPool(const void *POOL, size_t SIZE, int *FAILED) {
+        if (POOL == NULL || *FAILED) return NULL;
+
+        void *COPY = JUBI_MALLOC(SIZE);
+
+        if (COPY) memcpy(COPY, POOL, SIZE);
+        else *FAILED = 1;
+
+        return COPY;
     }
 
     int Jubi_WorldIsDestroyed(JubiWorld2D *WORLD) {
@@ -405,489 +1584,5540 @@ void JCollision_ResolveAABBvsAABB(Body2D *A, Body2D *B);
             return;
         };
 
-        for (int i=0; i < WORLD -> BodyCount; i++) {
-            Jubi_IntegrateBody(&WORLD -> Bodies[i], DeltaTime, WORLD -> Gravity);
-        }
+        Jubi__FinishAsync2D(WORLD);
+        Jubi__StepWorld2D(WORLD, DeltaTime, JUBI_STEP_ALL);
+    }
 
-        for (int i=0; i < WORLD -> BodyCount; i++) {
-            for (int j = i + 1; j < WORLD -> BodyCount; j++) {
-                Body2D *A = &WORLD -> Bodies[i];
-                Body2D *B = &WORLD -> Bodies[j];
+    // Skipped features are ignored for the step, not removed, e.g. bullets still exist but tunnel like normal bodies without JUBI_STEP_CONTINUOUS.
+    void Jubi_StepWorld2DEx(JubiWorld2D *WORLD, float DeltaTime, JUBI_UINT32 FEATURES) {
+        Jubi__IncrementErrorTick();
+        
+        if (Jubi_IsWorldValid(WORLD) < 1) {
+            Jubi__SetError(Jubi_GetWorldError(Jubi_IsWorldValid(WORLD)), __func__);
 
-                if (A -> Type == BODY_STATIC && B -> Type == BODY_STATIC) continue;
-                if (JCollision_AABBvsAABB(A -> Bounds, B -> Bounds)) {
-                    JCollision_ResolveAABBvsAABB(A, B);
-                }
-            }
-        }
+            return;
+        };
+
+        Jubi__FinishAsync2D(WORLD);
+        Jubi__StepWorld2D(WORLD, DeltaTime, FEATURES);
     }
 
-    // Global Helpers
+    // For profilers, e.g. reading hardware counters at every phase boundary. HOOK is NULL to stop.
+    int Jubi_SetPhaseHook2D(JubiWorld2D *WORLD, JubiPhaseHook2D HOOK, void *DATA) {
+        Jubi__IncrementErrorTick();
 
-    int Jubi_GetBodyIndex(JubiWorld2D *WORLD, Body2D *BODY) {
-        if (Jubi_IsWorldValid(WORLD) != 1 || BODY == NULL) return -1;
+        if (Jubi_IsWorldValid(WORLD) < 1) {
+            Jubi__SetError(Jubi_GetWorldError(Jubi_IsWorldValid(WORLD)), __func__);
 
-        for (int i=0; i < WORLD -> BodyCount; i++)  
-            if (&WORLD -> Bodies[i] == BODY) return i;
+            return -1;
+        }
 
-        return -1;
-    }
+        Jubi__FinishAsync2D(WORLD);
 
-    int Jubi_IsBodyInWorld(JubiWorld2D *WORLD, Body2D *BODY) {
-        if (Jubi_IsWorldValid(WORLD) != 1 || BODY == NULL) return -1;
+        WORLD -> PhaseHook = HOOK;
+        WORLD -> PhaseHookData = DATA;
 
-        for (int i=0; i < WORLD -> BodyCount; i++)
-            if (&WORLD -> Bodies[i] == BODY) return 1;
+        return 1;
+    }
 
-        return 0;
+    static JUBI_FORCE_INLINE void Jubi__EnterPhase2D(JubiWorld2D *WORLD, JubiPhase2D PHASE) {
+        if (WORLD -> PhaseHook) WORLD -> PhaseHook(WORLD -> PhaseHookData, PHASE);
     }
 
-    int Jubi_AddBodyToWorld(JubiWorld2D *WORLD, Body2D *BODY) {
-        Jubi__IncrementErrorTick();
-        
-        if (Jubi_IsWorldValid(WORLD) != 1) {
-            Jubi__SetError(Jubi_GetWorldError(Jubi_IsWorldValid(WORLD)), __func__);
+    // Force inlined, callers passing constant FEATURES (Jubi_StepWorld2D, Jubi.hpp) get a copy with the disabled phases compiled out
+    static JUBI_FORCE_INLINE void Jubi__StepWorld2D(JubiWorld2D *WORLD, float DeltaTime, JUBI_UINT32 FEATURES) {
+        Jubi__EnterPhase2D(WORLD, JUBI_PHASE_BEGIN);
 
-            return -1;
-        } else if (BODY == NULL) {
-            Jubi__SetError(JUBI_ERROR_NULL_BODY, __func__);
+        if (WORLD -> Recorder) {
+            Jubi__RecordStep2D(WORLD, DeltaTime, FEATURES);
 
-            return -1;
+            WORLD -> Recorder -> _Stepping = 1;
         }
 
-        if (WORLD -> BodyCount >= JUBI_MAX_BODIES) {
-            Jubi__SetError(JUBI_ERROR_WORLD_FULL, __func__);
-        
-            return -1;
+        Jubi__ResetArena(&WORLD -> Scratch);
+
+        // Last step's overlaps lived in the arena
+        WORLD -> SensorOverlaps = NULL;
+        WORLD -> SensorOverlapCount = 0;
+        WORLD -> _SensorOverlapCapacity = 0;
+
+        if (FEATURES & JUBI_STEP_STREAMING) {
+            Jubi__EnterPhase2D(WORLD, JUBI_PHASE_STREAMING);
+            Jubi__UpdateStreaming2D(WORLD);
         }
 
-        int INDEX = WORLD -> BodyCount++;
+        if (FEATURES & JUBI_STEP_LOD) {
+            Jubi__EnterPhase2D(WORLD, JUBI_PHASE_LOD);
+            Jubi__UpdateLOD2D(WORLD, DeltaTime);
+        }
 
-        WORLD -> Bodies[INDEX] = *BODY; 
-        WORLD -> Bodies[INDEX].WORLD = WORLD;
-        WORLD -> Bodies[INDEX].Index = INDEX;
+        if (WORLD -> ReorderInterval > 0 && WORLD -> StepCount % (JUBI_UINT64)WORLD -> ReorderInterval == 0) {
+            Jubi__EnterPhase2D(WORLD, JUBI_PHASE_REORDER);
+            Jubi__ReorderBodies2D(WORLD);
+        }
 
-        return INDEX;
-    }
+        Jubi__EnterPhase2D(WORLD, JUBI_PHASE_INTEGRATE);
 
-    int Jubi_RemoveBodyFromWorld(JubiWorld2D *WORLD, Body2D *BODY) {
-        Jubi__IncrementErrorTick();
-        
-        if (Jubi_IsWorldValid(WORLD) != 1) {
-            Jubi__SetError(Jubi_GetWorldError(Jubi_IsWorldValid(WORLD)), __func__);
+        int BULLETS = 0;
+
+        Vector2 UNIFORM_FORCE = {0, 0};
+
+        if (FEATURES & JUBI_STEP_FORCE_FIELDS) UNIFORM_FORCE = Jubi__ApplyForceFields2D(WORLD);
+
+        for (int i=0; i < WORLD -> BodyCount; i++)
+            if (WORLD -> Bodies[i].Flags & JUBI_BODY_BULLET) BULLETS++;
+
+        if ((FEATURES & JUBI_STEP_JOINTS) && WORLD -> _JointsDirty) Jubi__ColorJoints2D(WORLD);
+
+        if ((FEATURES & JUBI_STEP_JOINTS) && WORLD -> _ColorCount > 0 && WORLD -> JointSubsteps > 1) {
+            // Joints converge far better from several small steps than from more iterations on one big one, so worlds with joints integrate in substeps
+            int SUBSTEPS = WORLD -> JointSubsteps;
+            float SUBSTEP_TIME = DeltaTime / (float)SUBSTEPS;
+            float DRAG = powf(1.0f - AIR_RESISTANCE, 1.0f / (float)SUBSTEPS);
+
+            // Forces are cleared by integration, keep them for every substep (out of memory they only push the first)
+            Vector2 *FORCES = (Vector2 *)Jubi__ArenaAlloc(&WORLD -> Scratch, sizeof(Vector2) * WORLD -> BodyCount);
+
+            for (int i=0; FORCES && i < WORLD -> BodyCount; i++)
+                FORCES[i] = WORLD -> Bodies[i].AccumulatedForce;
+
+            for (int SUBSTEP=0; SUBSTEP < SUBSTEPS; SUBSTEP++) {
+                for (int i=0; i < WORLD -> BodyCount; i++) {
+                    Body2D *BODY = &WORLD -> Bodies[i];
+
+                    if (FORCES) BODY -> AccumulatedForce = FORCES[i];
+
+                    if (BODY -> _Skipped > 0.0f && !(BODY -> Flags & JUBI_BODY_HELD))
+                        Jubi__IntegrateBody2D(BODY, (DeltaTime + BODY -> _Skipped) / (float)SUBSTEPS, UNIFORM_FORCE, powf(DRAG, (DeltaTime + BODY -> _Skipped) / DeltaTime));
+                    else
+                        Jubi__IntegrateBody2D(BODY, SUBSTEP_TIME, UNIFORM_FORCE, DRAG);
+                }
+
+                Jubi__SolveJoints2D(WORLD, SUBSTEP_TIME);
+            }
+        } else {
+            for (int i=0; i < WORLD -> BodyCount; i++) {
+                Body2D *BODY = &WORLD -> Bodies[i];
+
+                // Lower LOD tiers make up the steps they skipped
+                if (BODY -> _Skipped > 0.0f && !(BODY -> Flags & JUBI_BODY_HELD))
+                    Jubi__IntegrateBody2D(BODY, DeltaTime + BODY -> _Skipped, UNIFORM_FORCE, powf(1.0f - AIR_RESISTANCE, (DeltaTime + BODY -> _Skipped) / DeltaTime));
+                else
+                    Jubi__IntegrateBody2D(BODY, DeltaTime, UNIFORM_FORCE, 1.0f - AIR_RESISTANCE);
+            }
+
+            if (FEATURES & JUBI_STEP_JOINTS) Jubi__SolveJoints2D(WORLD, DeltaTime);
+        }
+
+        for (int i=0; i < WORLD -> BodyCount; i++)
+            if (!(WORLD -> Bodies[i].Flags & JUBI_BODY_HELD)) WORLD -> Bodies[i]._Skipped = 0.0f;
+
+        Jubi__EnterPhase2D(WORLD, JUBI_PHASE_BROADPHASE);
+
+        WORLD -> _BroadphaseDirty = 1;
+        Jubi__UpdateBroadphase2D(WORLD);
+
+        if ((FEATURES & JUBI_STEP_CONTINUOUS) && BULLETS > 0) {
+            Jubi__EnterPhase2D(WORLD, JUBI_PHASE_CONTINUOUS);
+
+            int *CANDIDATES = (int *)Jubi__ArenaAlloc(&WORLD -> Scratch, sizeof(int) * WORLD -> BodyCount);
+
+            // Out of memory, bullets move like any other body this step
+            for (int i=0; CANDIDATES && i < WORLD -> BodyCount; i++) {
+                if ((WORLD -> Bodies[i].Flags & (JUBI_BODY_BULLET | JUBI_BODY_HELD | JUBI_BODY_SENSOR)) == JUBI_BODY_BULLET)
+                    Jubi__SolveContinuous2D(WORLD, &WORLD -> Bodies[i], DeltaTime, CANDIDATES);
+            }
+
+            // Bullets were pulled back along their path, re-sort before sweeping for pairs
+            WORLD -> _BroadphaseDirty = 1;
+            Jubi__UpdateBroadphase2D(WORLD);
+        }
+
+        Jubi__EnterPhase2D(WORLD, JUBI_PHASE_PAIRS);
+
+        // Gather every overlapping pair first, so resolving one pair can't change which pairs the sweep finds
+        int PAIR_CAPACITY = WORLD -> BodyCount * 4;
+        int PAIR_COUNT = 0;
+
+        JubiPair2D *PAIRS = (JubiPair2D *)Jubi__ArenaAlloc(&WORLD -> Scratch, sizeof(JubiPair2D) * PAIR_CAPACITY);
+        if (PAIRS == NULL) PAIR_CAPACITY = 0;
+
+        for (int i=0; i < WORLD -> _SortedCount; i++) {
+            Body2D *A = &WORLD -> Bodies[WORLD -> _SortedBodies[i]];
+
+            for (int j = i + 1; j < WORLD -> _SortedCount; j++) {
+                Body2D *B = &WORLD -> Bodies[WORLD -> _SortedBodies[j]];
+
+                if (B -> Bounds.Min.x >= A -> Bounds.Max.x) break;
+
+                if (A -> Type == BODY_STATIC && B -> Type == BODY_STATIC) continue;
+                if (!JCollision_AABBvsAABB(A -> Bounds, B -> Bounds)) continue;
+
+                // Sensors stop here, they're reported instead of resolved (& don't report each other), even for bodies this step won't move
+                if ((A -> Flags | B -> Flags) & JUBI_BODY_SENSOR) {
+                    if (!(A -> Flags & B -> Flags & JUBI_BODY_SENSOR) && Jubi__SensorOverlaps2D(A, B)) Jubi__AddSensorOverlap2D(WORLD, A, B);
+
+                    continue;
+                }
+
+                // Neither can be pushed (frozen & waiting bodies act static, kinematic bodies only move themselves)
+                if ((A -> Type != BODY_DYNAMIC || (A -> Flags & JUBI_BODY_HELD)) && (B -> Type != BODY_DYNAMIC || (B -> Flags & JUBI_BODY_HELD))) continue;
+
+                if (A -> Tier != B -> Tier) Jubi__PromoteContact2D(A, B);
+
+                if (PAIR_COUNT == PAIR_CAPACITY) {
+                    int CAPACITY = PAIR_CAPACITY > 0 ? PAIR_CAPACITY * 2 : 64;
+                    JubiPair2D *GROWN = (JubiPair2D *)Jubi__ArenaAlloc(&WORLD -> Scratch, sizeof(JubiPair2D) * CAPACITY);
+
+                    // Out of memory, only the pairs already found are resolved this step
+                    if (GROWN == NULL) continue;
+
+                    for (int p=0; p < PAIR_COUNT; p++) GROWN[p] = PAIRS[p];
+
+                    PAIRS = GROWN;
+                    PAIR_CAPACITY = CAPACITY;
+                }
+
+                PAIRS[PAIR_COUNT].A = A -> Index;
+                PAIRS[PAIR_COUNT].B = B -> Index;
+                PAIR_COUNT++;
+            }
+        }
+
+        Jubi__EnterPhase2D(WORLD, JUBI_PHASE_RESOLVE);
+
+        for (int i=0; i < PAIR_COUNT; i++) {
+            Body2D *A = &WORLD -> Bodies[PAIRS[i].A];
+            Body2D *B = &WORLD -> Bodies[PAIRS[i].B];
+
+            // Earlier pairs may have already pushed these two apart
+            if (!JCollision_AABBvsAABB(A -> Bounds, B -> Bounds)) continue;
+
+            Jubi__ResolvePair2D(A, B, FEATURES);
+        }
+
+        // Tiles go last, so other bodies can't shove anything into the level
+        if (FEATURES & JUBI_STEP_TILEMAPS) {
+            Jubi__EnterPhase2D(WORLD, JUBI_PHASE_TILEMAPS);
+            Jubi__CollideTilemaps2D(WORLD);
+        }
+
+        if (FEATURES & JUBI_STEP_PARTICLES) {
+            Jubi__EnterPhase2D(WORLD, JUBI_PHASE_PARTICLES);
+            Jubi__StepParticles2D(WORLD, DeltaTime);
+        }
+
+        // Resolution moved bodies, queries re-sort lazily
+        WORLD -> _BroadphaseDirty = 1;
+
+        WORLD -> StepCount++;
+
+        if (WORLD -> Transforms.Enabled) {
+            Jubi__EnterPhase2D(WORLD, JUBI_PHASE_TRANSFORMS);
+            Jubi__PublishTransforms2D(WORLD);
+        }
+
+        if (WORLD -> Recorder) WORLD -> Recorder -> _Stepping = 0;
+
+        Jubi__EnterPhase2D(WORLD, JUBI_PHASE_END);
+    }
+
+    // Broadphase
+
+    int Jubi_QueryAABB2D(JubiWorld2D *WORLD, AABB AREA, int *OUT, int MAX) {
+        Jubi__IncrementErrorTick();
+
+        if (Jubi_IsWorldValid(WORLD) != 1) {
+            Jubi__SetError(Jubi_GetWorldError(Jubi_IsWorldValid(WORLD)), __func__);
 
             return -1;
-        } else if (BODY == NULL) {
-            Jubi__SetError(JUBI_ERROR_NULL_BODY, __func__);
+        } else if (OUT == NULL && MAX > 0) {
+            Jubi__SetError(JUBI_ERROR_NULL_VALUE, __func__);
 
             return -1;
         }
 
-        int INDEX = Jubi_GetBodyIndex(WORLD, BODY);
-        if (INDEX < 0) return 0;
+        Jubi__UpdateBroadphase2D(WORLD);
 
-        for (int i = INDEX; i < WORLD -> BodyCount - 1; i++) {
-            WORLD -> Bodies[i] = WORLD -> Bodies[i + 1];
-            WORLD -> Bodies[i].Index = i;
-            WORLD -> Bodies[i].WORLD = WORLD;
+        return Jubi__QueryAABB2D(WORLD, AREA, OUT, MAX);
+    }
+
+    // Insertion sort, bodies barely move between steps so the order from the last step is almost always still sorted.
+    static void Jubi__UpdateBroadphase2D(JubiWorld2D *WORLD) {
+        if (!WORLD -> _BroadphaseDirty && WORLD -> _SortedCount == WORLD -> BodyCount) return;
+
+        int *SORTED = WORLD -> _SortedBodies;
+
+        // Adding/removing bodies shifts indices, start again from the identity order
+        if (WORLD -> _SortedCount != WORLD -> BodyCount) {
+            for (int i=0; i < WORLD -> BodyCount; i++) SORTED[i] = i;
+
+            WORLD -> _SortedCount = WORLD -> BodyCount;
         }
 
-        WORLD -> Bodies[WORLD -> BodyCount - 1] = (Body2D){0};
-        WORLD -> BodyCount--;
+        float MAX_WIDTH = 0.0f;
 
-        return 1;
+        for (int i=0; i < WORLD -> _SortedCount; i++) {
+            int INDEX = SORTED[i];
+            float KEY = WORLD -> Bodies[INDEX].Bounds.Min.x;
+            float WIDTH = WORLD -> Bodies[INDEX].Bounds.Max.x - KEY;
+
+            if (WIDTH > MAX_WIDTH) MAX_WIDTH = WIDTH;
+
+            int j = i - 1;
+
+            while (j >= 0 && WORLD -> Bodies[SORTED[j]].Bounds.Min.x > KEY) {
+                SORTED[j + 1] = SORTED[j];
+                j--;
+            }
+
+            SORTED[j + 1] = INDEX;
+        }
+
+        WORLD -> _MaxWidthX = MAX_WIDTH;
+        WORLD -> _BroadphaseDirty = 0;
     }
 
-    // Vector2 Math
+    // Returns the number of bodies overlapping AREA, only the first MAX are written to OUT (in sorted order).
+    static int Jubi__QueryAABB2D(JubiWorld2D *WORLD, AABB AREA, int *OUT, int MAX) {
+        int *SORTED = WORLD -> _SortedBodies;
+        int LOW = 0, HIGH = WORLD -> _SortedCount;
 
-    Vector2 JVector2_Add(Vector2 A, Vector2 B) {
-        Vector2 RESULT;
+        // Nothing starting further left than the widest body can reach AREA
+        float START = AREA.Min.x - WORLD -> _MaxWidthX;
 
-        RESULT.x = A.x + B.x;
-        RESULT.y = A.y + B.y;
+        while (LOW < HIGH) {
+            int MIDDLE = (LOW + HIGH) / 2;
 
-        return RESULT;
+            if (WORLD -> Bodies[SORTED[MIDDLE]].Bounds.Min.x < START) LOW = MIDDLE + 1;
+            else HIGH = MIDDLE;
+        }
+
+        int COUNT = 0;
+
+        for (int i = LOW; i < WORLD -> _SortedCount; i++) {
+            const AABB *BOUNDS = &WORLD -> Bodies[SORTED[i]].Bounds;
+
+            if (BOUNDS -> Min.x >= AREA.Max.x) break;
+            if (!JCollision_AABBvsAABB(*BOUNDS, AREA)) continue;
+
+            if (COUNT < MAX) OUT[COUNT] = SORTED[i];
+            COUNT++;
+        }
+
+        return COUNT;
     }
 
-    Vector2 JVector2_Subtract(Vector2 A, Vector2 B) {
-        Vector2 RESULT;
+    // Continuous Collision
 
-        RESULT.x = A.x - B.x;
-        RESULT.y = A.y - B.y;
+    // Sweeps a bullet from where it started the step to where integration left it, stopping at the first impact & sliding the leftover motion along the surface. Other bodies are treated as stationary at their end-of-step positions.
+    static void Jubi__SolveContinuous2D(JubiWorld2D *WORLD, Body2D *BODY, float DeltaTime, int *CANDIDATES) {
+        Vector2 START = {
+            BODY -> Position.x - BODY -> Velocity.x * DeltaTime,
+            BODY -> Position.y - BODY -> Velocity.y * DeltaTime
+        };
 
-        return RESULT;
+        Vector2 DISPLACEMENT = JVector2_Subtract(BODY -> Position, START);
+        int MOVED = 0;
+
+        for (int Iteration = 0; Iteration < JUBI_MAX_CCD_ITERATIONS; Iteration++) {
+            if (DISPLACEMENT.x == 0.0f && DISPLACEMENT.y == 0.0f) break;
+
+            Vector2 BACK = JVector2_Subtract(START, BODY -> Position);
+
+            AABB FROM = {JVector2_Add(BODY -> Bounds.Min, BACK), JVector2_Add(BODY -> Bounds.Max, BACK)};
+            AABB TO = {JVector2_Add(FROM.Min, DISPLACEMENT), JVector2_Add(FROM.Max, DISPLACEMENT)};
+            AABB SWEPT = {
+                {fminf(FROM.Min.x, TO.Min.x), fminf(FROM.Min.y, TO.Min.y)},
+                {fmaxf(FROM.Max.x, TO.Max.x), fmaxf(FROM.Max.y, TO.Max.y)}
+            };
+
+            int COUNT = Jubi__QueryAABB2D(WORLD, SWEPT, CANDIDATES, WORLD -> BodyCount);
+
+            float FIRST_TOI = 2.0f;
+            Vector2 FIRST_NORMAL = {0, 0};
+
+            for (int i=0; i < COUNT; i++) {
+                Body2D *OTHER = &WORLD -> Bodies[CANDIDATES[i]];
+
+                if (OTHER == BODY || (OTHER -> Flags & (JUBI_BODY_BULLET | JUBI_BODY_SENSOR))) continue;
+
+                float TOI;
+                Vector2 NORMAL;
+                int HIT;
+
+                if (BODY -> Shape == SHAPE_CIRCLE && OTHER -> Shape == SHAPE_CIRCLE) {
+                    Circle2D A = {START, BODY -> _Size.x * .5f};
+                    Circle2D B = {OTHER -> Position, OTHER -> _Size.x * .5f};
+
+                    HIT = JCollision_SweepCirclevsCircle(A, DISPLACEMENT, B, &TOI, &NORMAL);
+                } else if (BODY -> Shape == SHAPE_POLYGON || OTHER -> Shape == SHAPE_POLYGON) {
+                    JubiPolygon2D SCRATCH_A, SCRATCH_B;
+
+                    HIT = JCollision_SweepPolygonvsPolygon(Jubi__BodyPolygon2D(BODY, &SCRATCH_A), START, DISPLACEMENT, Jubi__BodyPolygon2D(OTHER, &SCRATCH_B), OTHER -> Position, &TOI, &NORMAL);
+                } else {
+                    HIT = JCollision_SweepAABBvsAABB(FROM, DISPLACEMENT, OTHER -> Bounds, &TOI, &NORMAL);
+                }
+
+                if (HIT && TOI < FIRST_TOI) {
+                    FIRST_TOI = TOI;
+                    FIRST_NORMAL = NORMAL;
+                }
+            }
+
+            if (FIRST_TOI > 1.0f) {
+                START = JVector2_Add(START, DISPLACEMENT);
+
+                break;
+            }
+
+            float LENGTH = JVector2_Length(DISPLACEMENT);
+            float TRAVEL = fmaxf(0.0f, FIRST_TOI - JUBI_CCD_SKIN / LENGTH);
+
+            START = JVector2_Add(START, JVector2_Scale(DISPLACEMENT, TRAVEL));
+            MOVED = 1;
+
+            // Slide the rest of the motion, and the velocity, along the surface
+            DISPLACEMENT = JVector2_Scale(DISPLACEMENT, 1.0f - TRAVEL);
+
+            float INTO = JVector2_Dot(DISPLACEMENT, FIRST_NORMAL);
+            if (INTO < 0.0f) DISPLACEMENT = JVector2_Subtract(DISPLACEMENT, JVector2_Scale(FIRST_NORMAL, INTO));
+
+            float SPEED_INTO = JVector2_Dot(BODY -> Velocity, FIRST_NORMAL);
+            if (SPEED_INTO < 0.0f) BODY -> Velocity = JVector2_Subtract(BODY -> Velocity, JVector2_Scale(FIRST_NORMAL, SPEED_INTO));
+
+            // Out of iterations, stop at the last impact rather than risk tunnelling with the leftover motion
+            if (Iteration == JUBI_MAX_CCD_ITERATIONS - 1) DISPLACEMENT = (Vector2){0, 0};
+        }
+
+        if (!MOVED) return;
+
+        BODY -> Position = START;
+
+        Jubi__UpdateBounds2D(BODY);
     }
 
-    Vector2 JVector2_Multiply(Vector2 A, Vector2 B) {
-        Vector2 RESULT;
+    // Shared Shapes
 
-        RESULT.x = A.x * B.x;
-        RESULT.y = A.y * B.y;
+    // Returns the id of a shape with this geometry, reusing an existing one when it's identical
+    int Jubi_CreateShape2D(JubiWorld2D *WORLD, Shape2D Shape, Vector2 Size) {
+        Jubi__IncrementErrorTick();
 
-        return RESULT;
+        if (Jubi_IsWorldValid(WORLD) != 1) {
+            Jubi__SetError(Jubi_GetWorldError(Jubi_IsWorldValid(WORLD)), __func__);
+
+            return -1;
+        } else if (Size.x <= 0.0f || Size.y <= 0.0f) {
+            Jubi__SetError(JUBI_ERROR_INVALID_VALUE, __func__);
+
+            return -1;
+        }
+
+        if (Shape == SHAPE_POLYGON) {
+            Jubi__SetError(JUBI_ERROR_INVALID_VALUE, __func__);
+
+            return -1;
+        }
+
+        for (int i=0; i < WORLD -> ShapeCount; i++) {
+            const JubiShape2D *EXISTING = &WORLD -> Shapes[i];
+
+            if (EXISTING -> Type == Shape && EXISTING -> Size.x == Size.x && EXISTING -> Size.y == Size.y) return i;
+        }
+
+        if (WORLD -> Shapes == NULL) WORLD -> Shapes = (JubiShape2D *)JUBI_MALLOC(sizeof(JubiShape2D) * JUBI_MAX_SHAPES);
+
+        if (WORLD -> ShapeCount >= JUBI_MAX_SHAPES || WORLD -> Shapes == NULL) {
+            Jubi__SetError(JUBI_ERROR_WORLD_FULL, __func__);
+
+            return -1;
+        }
+
+        JubiShape2D *SHAPE = &WORLD -> Shapes[WORLD -> ShapeCount];
+
+        SHAPE -> Type = Shape;
+        SHAPE -> Size = Size;
+        SHAPE -> HalfSize = (Vector2){Size.x * .5f, Size.y * .5f};
+        SHAPE -> Offset = (Vector2){0, 0};
+        SHAPE -> PolygonId = -1;
+
+        return WORLD -> ShapeCount++;
     }
 
-    Vector2 JVector2_Divide(Vector2 A, Vector2 B) {
-        Vector2 RESULT;
+    // VERTICES are relative to the position of the bodies using the shape, & must form a convex polygon (either winding).
+    int Jubi_CreatePolygonShape2D(JubiWorld2D *WORLD, const Vector2 *VERTICES, int COUNT) {
+        Jubi__IncrementErrorTick();
 
-        RESULT.x = A.x / B.x;
-        RESULT.y = A.y / B.y;
+        if (Jubi_IsWorldValid(WORLD) != 1) {
+            Jubi__SetError(Jubi_GetWorldError(Jubi_IsWorldValid(WORLD)), __func__);
 
-        return RESULT;
+            return -1;
+        } else if (VERTICES == NULL) {
+            Jubi__SetError(JUBI_ERROR_NULL_VALUE, __func__);
+
+            return -1;
+        }
+
+        if (WORLD -> Shapes == NULL) WORLD -> Shapes = (JubiShape2D *)JUBI_MALLOC(sizeof(JubiShape2D) * JUBI_MAX_SHAPES);
+        if (WORLD -> Polygons == NULL) WORLD -> Polygons = (JubiPolygon2D *)JUBI_MALLOC(sizeof(JubiPolygon2D) * JUBI_MAX_POLYGONS);
+
+        if (WORLD -> ShapeCount >= JUBI_MAX_SHAPES || WORLD -> PolygonCount >= JUBI_MAX_POLYGONS || WORLD -> Shapes == NULL || WORLD -> Polygons == NULL) {
+            Jubi__SetError(JUBI_ERROR_WORLD_FULL, __func__);
+
+            return -1;
+        }
+
+        JubiPolygon2D *POLYGON = &WORLD -> Polygons[WORLD -> PolygonCount];
+
+        if (!JPolygon2D_Init(POLYGON, VERTICES, COUNT)) {
+            Jubi__SetError(JUBI_ERROR_INVALID_VALUE, __func__);
+
+            return -1;
+        }
+
+        Vector2 MIN = POLYGON -> Vertices[0], MAX = POLYGON -> Vertices[0];
+
+        for (int i=1; i < POLYGON -> Count; i++) {
+            MIN.x = fminf(MIN.x, POLYGON -> Vertices[i].x);
+            MIN.y = fminf(MIN.y, POLYGON -> Vertices[i].y);
+            MAX.x = fmaxf(MAX.x, POLYGON -> Vertices[i].x);
+            MAX.y = fmaxf(MAX.y, POLYGON -> Vertices[i].y);
+        }
+
+        JubiShape2D *SHAPE = &WORLD -> Shapes[WORLD -> ShapeCount];
+
+        SHAPE -> Type = SHAPE_POLYGON;
+        SHAPE -> Size = JVector2_Subtract(MAX, MIN);
+        SHAPE -> HalfSize = JVector2_Scale(SHAPE -> Size, .5f);
+        SHAPE -> Offset = JVector2_Scale(JVector2_Add(MIN, MAX), .5f);
+        SHAPE -> PolygonId = WORLD -> PolygonCount++;
+
+        return WORLD -> ShapeCount++;
     }
 
-    float JVector2_Length(Vector2 A) {
-        return sqrt(A.x * A.x + A.y * A.y);
+    // Force Fields
+
+    JubiForceField2D JForceField2D_Directional(Vector2 FORCE) {
+        // Every member spelled out, {0} can't start with an enum in C++ & a partial list warns under -Wextra
+        JubiForceField2D FIELD = {FIELD_DIRECTIONAL, FORCE, {0, 0}, 0.0f, 0.0f, {{0, 0}, {0, 0}}, 0, 0, 0};
+
+        return FIELD;
     }
 
-    Vector2 JVector2_Scale(Vector2 A, float Scalar) {
-        Vector2 RESULT;
+    JubiForceField2D JForceField2D_Radial(Vector2 CENTER, float RADIUS, float STRENGTH) {
+        JubiForceField2D FIELD = {FIELD_RADIAL, {0, 0}, CENTER, RADIUS, STRENGTH, {{0, 0}, {0, 0}}, 0, 0, 0};
 
-        RESULT.x = A.x * Scalar;
-        RESULT.y = A.y * Scalar;
+        return FIELD;
+    }
 
-        return RESULT;
+    // A radial field applied once as an impulse
+    JubiForceField2D JForceField2D_Explosion(Vector2 CENTER, float RADIUS, float STRENGTH) {
+        JubiForceField2D FIELD = JForceField2D_Radial(CENTER, RADIUS, STRENGTH);
+
+        FIELD.Impulse = 1;
+
+        return FIELD;
     }
 
-    float JVector2_Dot(Vector2 A, Vector2 B) {
-        return A.x * B.x + A.y * B.y;
+    JubiForceField2D JForceField2D_Attractor(Vector2 CENTER, float RADIUS, float STRENGTH) {
+        JubiForceField2D FIELD = JForceField2D_Radial(CENTER, RADIUS, STRENGTH);
+
+        FIELD.Type = FIELD_ATTRACTOR;
+
+        return FIELD;
+    }
+
+    void JForceField2D_SetRegion(JubiForceField2D *FIELD, AABB REGION) {
+        if (FIELD == NULL) return;
+
+        FIELD -> Region = REGION;
+        FIELD -> HasRegion = 1;
+    }
+
+    // Returns the field's id, for Jubi_RemoveForceField2D
+    int Jubi_AddForceField2D(JubiWorld2D *WORLD, JubiForceField2D FIELD) {
+        Jubi__IncrementErrorTick();
+
+        if (Jubi_IsWorldValid(WORLD) != 1) {
+            Jubi__SetError(Jubi_GetWorldError(Jubi_IsWorldValid(WORLD)), __func__);
+
+            return -1;
+        } else if (FIELD.Type != FIELD_DIRECTIONAL && FIELD.Radius <= 0.0f) {
+            Jubi__SetError(JUBI_ERROR_INVALID_VALUE, __func__);
+
+            return -1;
+        }
+
+        for (int i=0; i < JUBI_MAX_FORCE_FIELDS; i++) {
+            if (WORLD -> ForceFields[i].Active) continue;
+
+            WORLD -> ForceFields[i] = FIELD;
+            WORLD -> ForceFields[i].Active = 1;
+
+            return i;
+        }
+
+        Jubi__SetError(JUBI_ERROR_WORLD_FULL, __func__);
+
+        return -1;
+    }
+
+    int Jubi_RemoveForceField2D(JubiWorld2D *WORLD, int ID) {
+        Jubi__IncrementErrorTick();
+
+        if (Jubi_IsWorldValid(WORLD) != 1) {
+            Jubi__SetError(Jubi_GetWorldError(Jubi_IsWorldValid(WORLD)), __func__);
+
+            return -1;
+        } else if (ID < 0 || ID >= JUBI_MAX_FORCE_FIELDS) {
+            Jubi__SetError(JUBI_ERROR_INVALID_VALUE, __func__);
+
+            return -1;
+        }
+
+        if (!WORLD -> ForceFields[ID].Active) return 0;
+
+        WORLD -> ForceFields[ID].Active = 0;
+
+        return 1;
     }
 
-    float JVector2_Cross(Vector2 A, Vector2 B) {
-        return A.x * B.y - A.y * B.x;
+    // Writes every local field straight into the bodies it reaches, found through the broadphase. Uniform fields (directional without a region) are the same for every body, so they are summed & returned for the integration pass to add alongside gravity, rather than touching each body here.
+    static Vector2 Jubi__ApplyForceFields2D(JubiWorld2D *WORLD) {
+        int *CANDIDATES = NULL;
+        Vector2 UNIFORM = {0, 0};
+
+        for (int f=0; f < JUBI_MAX_FORCE_FIELDS; f++) {
+            JubiForceField2D *FIELD = &WORLD -> ForceFields[f];
+            if (!FIELD -> Active) continue;
+
+            if (FIELD -> Type == FIELD_DIRECTIONAL && !FIELD -> HasRegion && !FIELD -> Impulse) {
+                UNIFORM = JVector2_Add(UNIFORM, FIELD -> Force);
+
+                continue;
+            }
+
+            AABB AREA;
+
+            if (FIELD -> Type == FIELD_DIRECTIONAL) {
+                AREA = FIELD -> HasRegion ? FIELD -> Region : (AABB){{-INFINITY, -INFINITY}, {INFINITY, INFINITY}};
+            } else {
+                AREA = JInitialize_AABB(FIELD -> Center, (Vector2){FIELD -> Radius * 2.0f, FIELD -> Radius * 2.0f});
+
+                if (FIELD -> HasRegion) {
+                    AREA.Min.x = fmaxf(AREA.Min.x, FIELD -> Region.Min.x);
+                    AREA.Min.y = fmaxf(AREA.Min.y, FIELD -> Region.Min.y);
+                    AREA.Max.x = fminf(AREA.Max.x, FIELD -> Region.Max.x);
+                    AREA.Max.y = fminf(AREA.Max.y, FIELD -> Region.Max.y);
+                }
+            }
+
+            if (CANDIDATES == NULL) {
+                CANDIDATES = (int *)Jubi__ArenaAlloc(&WORLD -> Scratch, sizeof(int) * WORLD -> BodyCount);
+
+                // Out of memory, local fields skip this step
+                if (CANDIDATES == NULL) continue;
+
+                Jubi__UpdateBroadphase2D(WORLD);
+            }
+
+            int COUNT = Jubi__QueryAABB2D(WORLD, AREA, CANDIDATES, WORLD -> BodyCount);
+
+            for (int i=0; i < COUNT; i++) {
+                Body2D *BODY = &WORLD -> Bodies[CANDIDATES[i]];
+                if (BODY -> Type != BODY_DYNAMIC || BODY -> InvMass <= 0.0f || (BODY -> Flags & JUBI_BODY_HELD)) continue;
+
+                Vector2 FORCE = FIELD -> Force;
+
+                if (FIELD -> Type != FIELD_DIRECTIONAL) {
+                    Vector2 OFFSET = JVector2_Subtract(BODY -> Position, FIELD -> Center);
+                    float DISTANCE = JVector2_Length(OFFSET);
+
+                    if (DISTANCE >= FIELD -> Radius || DISTANCE == 0.0f) continue;
+
+                    float SCALE = FIELD -> Strength * (1.0f - DISTANCE / FIELD -> Radius) / DISTANCE;
+                    if (FIELD -> Type == FIELD_ATTRACTOR) SCALE = -SCALE;
+
+                    FORCE = JVector2_Scale(OFFSET, SCALE);
+                }
+
+                if (FIELD -> Impulse) {
+                    BODY -> Velocity.x += FORCE.x * BODY -> InvMass;
+                    BODY -> Velocity.y += FORCE.y * BODY -> InvMass;
+                } else {
+                    BODY -> AccumulatedForce.x += FORCE.x;
+                    BODY -> AccumulatedForce.y += FORCE.y;
+                }
+            }
+
+            if (FIELD -> Impulse) FIELD -> Active = 0;
+        }
+
+        return UNIFORM;
+    }
+
+    // Joints
+
+    JubiJoint2D JJoint2D_Distance(int BodyA, int BodyB, Vector2 AnchorA, Vector2 AnchorB, float Length) {
+        JubiJoint2D JOINT = {JOINT_DISTANCE};
+
+        JOINT.BodyA = BodyA;
+        JOINT.BodyB = BodyB;
+        JOINT.AnchorA = AnchorA;
+        JOINT.AnchorB = AnchorB;
+        JOINT.Length = Length;
+        JOINT.Stiffness = 1.0f;
+
+        return JOINT;
+    }
+
+    JubiJoint2D JJoint2D_Revolute(int BodyA, int BodyB, Vector2 AnchorA, Vector2 AnchorB) {
+        JubiJoint2D JOINT = JJoint2D_Distance(BodyA, BodyB, AnchorA, AnchorB, 0.0f);
+
+        JOINT.Type = JOINT_REVOLUTE;
+
+        return JOINT;
+    }
+
+    // The offset between the bodies when the joint is added is kept
+    JubiJoint2D JJoint2D_Weld(int BodyA, int BodyB) {
+        JubiJoint2D JOINT = JJoint2D_Distance(BodyA, BodyB, (Vector2){0, 0}, (Vector2){0, 0}, 0.0f);
+
+        JOINT.Type = JOINT_WELD;
+
+        return JOINT;
+    }
+
+    // Returns the joint's id, for Jubi_RemoveJoint2D
+    int Jubi_AddJoint2D(JubiWorld2D *WORLD, JubiJoint2D JOINT) {
+        Jubi__IncrementErrorTick();
+
+        if (Jubi_IsWorldValid(WORLD) != 1) {
+            Jubi__SetError(Jubi_GetWorldError(Jubi_IsWorldValid(WORLD)), __func__);
+
+            return -1;
+        }
+
+        Body2D *A = Jubi__JointBody2D(WORLD, JOINT.BodyA);
+        Body2D *B = Jubi__JointBody2D(WORLD, JOINT.BodyB);
+
+        if (A == NULL || B == NULL || A == B) {
+            Jubi__SetError(JUBI_ERROR_INVALID_VALUE, __func__);
+
+            return -1;
+        }
+
+        if (JOINT.Type == JOINT_WELD) {
+            JOINT.AnchorA = JVector2_Subtract(B -> Position, A -> Position);
+            JOINT.AnchorB = (Vector2){0, 0};
+        } else if (JOINT.Type == JOINT_DISTANCE && JOINT.Length < 0.0f) {
+            JOINT.Length = JVector2_Distance(JVector2_Add(A -> Position, JOINT.AnchorA), JVector2_Add(B -> Position, JOINT.AnchorB));
+        }
+
+        if (JOINT.Stiffness <= 0.0f || JOINT.Stiffness > 1.0f) JOINT.Stiffness = 1.0f;
+
+        if (WORLD -> Joints == NULL) {
+            WORLD -> Joints = (JubiJoint2D *)JUBI_MALLOC(sizeof(JubiJoint2D) * JUBI_MAX_JOINTS);
+
+            if (WORLD -> Joints == NULL) {
+                Jubi__SetError(JUBI_ERROR_WORLD_FULL, __func__);
+
+                return -1;
+            }
+
+            for (int i=0; i < JUBI_MAX_JOINTS; i++)
+                WORLD -> Joints[i].Active = 0;
+        }
+
+        for (int i=0; i < JUBI_MAX_JOINTS; i++) {
+            if (WORLD -> Joints[i].Active) continue;
+
+            WORLD -> Joints[i] = JOINT;
+            WORLD -> Joints[i].Active = 1;
+            WORLD -> _JointsDirty = 1;
+
+            return i;
+        }
+
+        Jubi__SetError(JUBI_ERROR_WORLD_FULL, __func__);
+
+        return -1;
+    }
+
+    int Jubi_RemoveJoint2D(JubiWorld2D *WORLD, int ID) {
+        Jubi__IncrementErrorTick();
+
+        if (Jubi_IsWorldValid(WORLD) != 1) {
+            Jubi__SetError(Jubi_GetWorldError(Jubi_IsWorldValid(WORLD)), __func__);
+
+            return -1;
+        } else if (ID < 0 || ID >= JUBI_MAX_JOINTS) {
+            Jubi__SetError(JUBI_ERROR_INVALID_VALUE, __func__);
+
+            return -1;
+        }
+
+        if (WORLD -> Joints == NULL || !WORLD -> Joints[ID].Active) return 0;
+
+        WORLD -> Joints[ID].Active = 0;
+        WORLD -> _JointsDirty = 1;
+
+        return 1;
+    }
+
+    static Body2D *Jubi__JointBody2D(JubiWorld2D *WORLD, int HANDLE) {
+        if (HANDLE < 0 || HANDLE >= JUBI_MAX_BODIES) return NULL;
+
+        int INDEX = WORLD -> _HandleToIndex[HANDLE];
+
+        return INDEX < 0 ? NULL : &WORLD -> Bodies[INDEX];
+    }
+
+    // Removed bodies' handles are handed out again (last freed, first reused), so joints on them have to go before the next body is created or it's silently attached
+    static void Jubi__DetachJoints2D(JubiWorld2D *WORLD) {
+        if (WORLD -> Joints == NULL) return;
+
+        for (int j=0; j < JUBI_MAX_JOINTS; j++) {
+            JubiJoint2D *JOINT = &WORLD -> Joints[j];
+            if (!JOINT -> Active) continue;
+
+            if (Jubi__JointBody2D(WORLD, JOINT -> BodyA) && Jubi__JointBody2D(WORLD, JOINT -> BodyB)) continue;
+
+            JOINT -> Active = 0;
+            WORLD -> _JointsDirty = 1;
+        }
+    }
+
+    // Greedy coloring in joint id order, so the same joints always get the same colors. Two joints share a color only if they don't move any body in common, which makes every joint in a color independent. Static bodies are never moved, so any number of joints can hang off the same one. A body with more joints than there are colors spills into the last color, which is always solved on one thread.
+    static void Jubi__ColorJoints2D(JubiWorld2D *WORLD) {
+        if (WORLD -> Joints == NULL) {
+            WORLD -> _ColorCount = 0;
+            WORLD -> _JointsDirty = 0;
+
+            return;
+        }
+
+        JUBI_UINT32 *USED = (JUBI_UINT32 *)Jubi__ArenaAlloc(&WORLD -> Scratch, sizeof(JUBI_UINT32) * JUBI_MAX_BODIES);
+        JUBI_UINT8 *COLORS = (JUBI_UINT8 *)Jubi__ArenaAlloc(&WORLD -> Scratch, sizeof(JUBI_UINT8) * JUBI_MAX_JOINTS);
+
+        // Out of memory, no joint is solved until a later step manages to color them (they stay dirty)
+        if (USED == NULL || COLORS == NULL) {
+            WORLD -> _ColorCount = 0;
+
+            return;
+        }
+
+        int COUNTS[JUBI_MAX_JOINT_COLORS] = {0};
+
+        for (int i=0; i < JUBI_MAX_BODIES; i++) USED[i] = 0;
+
+        WORLD -> _ColorCount = 0;
+
+        for (int i=0; i < JUBI_MAX_JOINTS; i++) {
+            JubiJoint2D *JOINT = &WORLD -> Joints[i];
+            if (!JOINT -> Active) continue;
+
+            Body2D *A = Jubi__JointBody2D(WORLD, JOINT -> BodyA);
+            Body2D *B = Jubi__JointBody2D(WORLD, JOINT -> BodyB);
+
+            int MOVES_A = A && A -> Type == BODY_DYNAMIC;
+            int MOVES_B = B && B -> Type == BODY_DYNAMIC;
+
+            JUBI_UINT32 TAKEN = (MOVES_A ? USED[JOINT -> BodyA] : 0) | (MOVES_B ? USED[JOINT -> BodyB] : 0);
+
+            int COLOR = 0;
+
+            while (COLOR < JUBI_MAX_JOINT_COLORS - 1 && (TAKEN & (1u << COLOR))) COLOR++;
+
+            if (COLOR < JUBI_MAX_JOINT_COLORS - 1) {
+                if (MOVES_A) USED[JOINT -> BodyA] |= 1u << COLOR;
+                if (MOVES_B) USED[JOINT -> BodyB] |= 1u << COLOR;
+            }
+
+            COLORS[i] = (JUBI_UINT8)COLOR;
+            COUNTS[COLOR]++;
+
+            if (COLOR + 1 > WORLD -> _ColorCount) WORLD -> _ColorCount = COLOR + 1;
+        }
+
+        WORLD -> _ColorStart[0] = 0;
+
+        for (int c=0; c < WORLD -> _ColorCount; c++)
+            WORLD -> _ColorStart[c + 1] = WORLD -> _ColorStart[c] + COUNTS[c];
+
+        // Counts become write cursors
+        for (int c=0; c < WORLD -> _ColorCount; c++)
+            COUNTS[c] = WORLD -> _ColorStart[c];
+
+        for (int i=0; i < JUBI_MAX_JOINTS; i++)
+            if (WORLD -> Joints[i].Active) WORLD -> _JointOrder[COUNTS[COLORS[i]]++] = i;
+
+        WORLD -> _JointsDirty = 0;
+    }
+
+    // Position based, the anchors are projected back into place & the correction is added to the velocity so the bodies don't fly apart on the next step
+    static void Jubi__SolveJoint2D(JubiWorld2D *WORLD, JubiJoint2D *JOINT, float InvDeltaTime) {
+        Body2D *A = Jubi__JointBody2D(WORLD, JOINT -> BodyA);
+        Body2D *B = Jubi__JointBody2D(WORLD, JOINT -> BodyB);
+
+        if (A == NULL || B == NULL) return;
+
+        float WA = A -> Type == BODY_DYNAMIC && !(A -> Flags & JUBI_BODY_HELD) ? A -> InvMass : 0.0f;
+        float WB = B -> Type == BODY_DYNAMIC && !(B -> Flags & JUBI_BODY_HELD) ? B -> InvMass : 0.0f;
+
+        if (WA + WB <= 0.0f) return;
+
+        Vector2 D = JVector2_Subtract(JVector2_Add(B -> Position, JOINT -> AnchorB), JVector2_Add(A -> Position, JOINT -> AnchorA));
+        Vector2 CORRECTION = D;
+
+        if (JOINT -> Type == JOINT_DISTANCE) {
+            float LENGTH = JVector2_Length(D);
+
+            if (LENGTH == 0.0f) return;
+
+            CORRECTION = JVector2_Scale(D, (LENGTH - JOINT -> Length) / LENGTH);
+        }
+
+        CORRECTION = JVector2_Scale(CORRECTION, JOINT -> Stiffness / (WA + WB));
+
+        A -> Position = JVector2_Add(A -> Position, JVector2_Scale(CORRECTION, WA));
+        B -> Position = JVector2_Subtract(B -> Position, JVector2_Scale(CORRECTION, WB));
+
+        A -> Velocity = JVector2_Add(A -> Velocity, JVector2_Scale(CORRECTION, WA * InvDeltaTime));
+        B -> Velocity = JVector2_Subtract(B -> Velocity, JVector2_Scale(CORRECTION, WB * InvDeltaTime));
+    }
+
+    typedef struct {
+        JubiWorld2D *WORLD;
+        const int *JOINTS;
+        int COUNT;
+        float InvDeltaTime;
+    } Jubi__JointBatch2D;
+
+    static void Jubi__SolveJointTask2D(void *DATA, int INDEX) {
+        Jubi__JointBatch2D *BATCH = (Jubi__JointBatch2D *)DATA;
+
+        int START = INDEX * JUBI_JOINT_TASK_SIZE;
+        int END = START + JUBI_JOINT_TASK_SIZE < BATCH -> COUNT ? START + JUBI_JOINT_TASK_SIZE : BATCH -> COUNT;
+
+        for (int i=START; i < END; i++)
+            Jubi__SolveJoint2D(BATCH -> WORLD, &BATCH -> WORLD -> Joints[BATCH -> JOINTS[i]], BATCH -> InvDeltaTime);
+    }
+
+    // Colors are solved one after another (Gauss-Seidel between colors), the joints inside a color in any order or in parallel, so the result is the same however the scheduler splits the work.
+    static void Jubi__SolveJoints2D(JubiWorld2D *WORLD, float DeltaTime) {
+        if (WORLD -> _JointsDirty) Jubi__ColorJoints2D(WORLD);
+
+        if (WORLD -> _ColorCount == 0 || DeltaTime <= 0.0f) return;
+
+        Jubi__JointBatch2D BATCH = {WORLD, NULL, 0, 1.0f / DeltaTime};
+
+        for (int ITERATION=0; ITERATION < WORLD -> JointIterations; ITERATION++) {
+            for (int c=0; c < WORLD -> _ColorCount; c++) {
+                BATCH.JOINTS = &WORLD -> _JointOrder[WORLD -> _ColorStart[c]];
+                BATCH.COUNT = WORLD -> _ColorStart[c + 1] - WORLD -> _ColorStart[c];
+
+                // Small colors aren't worth waking other threads for, & the last color may share bodies
+                if (c < JUBI_MAX_JOINT_COLORS - 1 && BATCH.COUNT >= JUBI_JOINT_TASK_SIZE * 2) {
+                    Jubi__RunTasks(Jubi__SolveJointTask2D, &BATCH, (BATCH.COUNT + JUBI_JOINT_TASK_SIZE - 1) / JUBI_JOINT_TASK_SIZE);
+                } else {
+                    for (int i=0; i < BATCH.COUNT; i++)
+                        Jubi__SolveJoint2D(WORLD, &WORLD -> Joints[BATCH.JOINTS[i]], BATCH.InvDeltaTime);
+                }
+            }
+        }
+
+        for (int i=0; i < WORLD -> _ColorStart[WORLD -> _ColorCount]; i++) {
+            JubiJoint2D *JOINT = &WORLD -> Joints[WORLD -> _JointOrder[i]];
+            Body2D *A = Jubi__JointBody2D(WORLD, JOINT -> BodyA);
+            Body2D *B = Jubi__JointBody2D(WORLD, JOINT -> BodyB);
+
+            if (A) Jubi__UpdateBounds2D(A);
+            if (B) Jubi__UpdateBounds2D(B);
+        }
+    }
+
+    // Tilemaps
+
+    // Tiles start empty. Returns the tilemap's id, for the other Jubi_*Tile* functions.
+    int Jubi_CreateTilemap2D(JubiWorld2D *WORLD, int WIDTH, int HEIGHT, float TILE_SIZE, Vector2 ORIGIN) {
+        Jubi__IncrementErrorTick();
+
+        if (Jubi_IsWorldValid(WORLD) != 1) {
+            Jubi__SetError(Jubi_GetWorldError(Jubi_IsWorldValid(WORLD)), __func__);
+
+            return -1;
+        } else if (WIDTH <= 0 || HEIGHT <= 0 || TILE_SIZE <= 0.0f) {
+            Jubi__SetError(JUBI_ERROR_INVALID_VALUE, __func__);
+
+            return -1;
+        }
+
+        for (int i=0; i < JUBI_MAX_TILEMAPS; i++) {
+            JubiTilemap2D *MAP = &WORLD -> Tilemaps[i];
+            if (MAP -> Tiles != NULL) continue;
+
+            size_t SIZE = (size_t)WIDTH * (size_t)HEIGHT;
+
+            MAP -> Tiles = (JUBI_UINT8 *)JUBI_MALLOC(SIZE);
+
+            if (MAP -> Tiles == NULL) {
+                Jubi__SetError(JUBI_ERROR_NULL_VALUE, __func__);
+
+                return -1;
+            }
+
+            for (size_t t=0; t < SIZE; t++) MAP -> Tiles[t] = 0;
+
+            MAP -> Width = WIDTH;
+            MAP -> Height = HEIGHT;
+            MAP -> TileSize = TILE_SIZE;
+            MAP -> Origin = ORIGIN;
+
+            return i;
+        }
+
+        Jubi__SetError(JUBI_ERROR_WORLD_FULL, __func__);
+
+        return -1;
+    }
+
+    int Jubi_DestroyTilemap2D(JubiWorld2D *WORLD, int ID) {
+        Jubi__IncrementErrorTick();
+
+        JubiTilemap2D *MAP = Jubi__GetTilemap2D(WORLD, ID, __func__);
+        if (MAP == NULL) return -1;
+
+        JUBI_FREE(MAP -> Tiles);
+
+        *MAP = (JubiTilemap2D){0};
+
+        return 1;
+    }
+
+    // Any nonzero VALUE is solid, the value itself is left for the game (tile types, materials, ...)
+    int Jubi_SetTile2D(JubiWorld2D *WORLD, int ID, int X, int Y, JUBI_UINT8 VALUE) {
+        Jubi__IncrementErrorTick();
+
+        JubiTilemap2D *MAP = Jubi__GetTilemap2D(WORLD, ID, __func__);
+        if (MAP == NULL) return -1;
+
+        if (X < 0 || Y < 0 || X >= MAP -> Width || Y >= MAP -> Height) {
+            Jubi__SetError(JUBI_ERROR_INVALID_VALUE, __func__);
+
+            return -1;
+        }
+
+        MAP -> Tiles[Y * MAP -> Width + X] = VALUE;
+
+        return 1;
+    }
+
+    int Jubi_GetTile2D(JubiWorld2D *WORLD, int ID, int X, int Y) {
+        Jubi__IncrementErrorTick();
+
+        JubiTilemap2D *MAP = Jubi__GetTilemap2D(WORLD, ID, __func__);
+        if (MAP == NULL) return -1;
+
+        if (X < 0 || Y < 0 || X >= MAP -> Width || Y >= MAP -> Height) return 0;
+
+        return MAP -> Tiles[Y * MAP -> Width + X];
+    }
+
+    // Copies a whole level in at once, TILES is Width * Height bytes, row by row
+    int Jubi_SetTiles2D(JubiWorld2D *WORLD, int ID, const JUBI_UINT8 *TILES) {
+        Jubi__IncrementErrorTick();
+
+        JubiTilemap2D *MAP = Jubi__GetTilemap2D(WORLD, ID, __func__);
+        if (MAP == NULL) return -1;
+
+        if (TILES == NULL) {
+            Jubi__SetError(JUBI_ERROR_NULL_VALUE, __func__);
+
+            return -1;
+        }
+
+        size_t SIZE = (size_t)MAP -> Width * (size_t)MAP -> Height;
+
+        for (size_t t=0; t < SIZE; t++) MAP -> Tiles[t] = TILES[t];
+
+        return 1;
+    }
+
+    static JubiTilemap2D *Jubi__GetTilemap2D(JubiWorld2D *WORLD, int ID, const char *FUNCTION) {
+        if (Jubi_IsWorldValid(WORLD) != 1) {
+            Jubi__SetError(Jubi_GetWorldError(Jubi_IsWorldValid(WORLD)), FUNCTION);
+
+            return NULL;
+        } else if (ID < 0 || ID >= JUBI_MAX_TILEMAPS || WORLD -> Tilemaps[ID].Tiles == NULL) {
+            Jubi__SetError(JUBI_ERROR_INVALID_VALUE, FUNCTION);
+
+            return NULL;
+        }
+
+        return &WORLD -> Tilemaps[ID];
+    }
+
+    static void Jubi__FreeTilemaps2D(JubiWorld2D *WORLD) {
+        for (int i=0; i < JUBI_MAX_TILEMAPS; i++) {
+            JUBI_FREE(WORLD -> Tilemaps[i].Tiles);
+
+            WORLD -> Tilemaps[i] = (JubiTilemap2D){0};
+        }
+    }
+
+    // Outside the map counts as empty
+    static int Jubi__TileSolid2D(const JubiTilemap2D *MAP, int X, int Y) {
+        if (X < 0 || Y < 0 || X >= MAP -> Width || Y >= MAP -> Height) return 0;
+
+        return MAP -> Tiles[Y * MAP -> Width + X] != 0;
+    }
+
+    // Only scans the tiles under BODY's bounds. A tile can only push through a face that isn't covered by a neighbouring solid tile, so a row of tiles acts like one long edge & bodies slide across the seams between them instead of catching on the inner corners.
+    static void Jubi__CollideTilemap2D(const JubiTilemap2D *MAP, Body2D *BODY) {
+        float INV_SIZE = 1.0f / MAP -> TileSize;
+
+        int X0 = (int)floorf((BODY -> Bounds.Min.x - MAP -> Origin.x) * INV_SIZE);
+        int Y0 = (int)floorf((BODY -> Bounds.Min.y - MAP -> Origin.y) * INV_SIZE);
+        int X1 = (int)floorf((BODY -> Bounds.Max.x - MAP -> Origin.x) * INV_SIZE);
+        int Y1 = (int)floorf((BODY -> Bounds.Max.y - MAP -> Origin.y) * INV_SIZE);
+
+        if (X1 < 0 || Y1 < 0 || X0 >= MAP -> Width || Y0 >= MAP -> Height) return;
+
+        if (X0 < 0) X0 = 0;
+        if (Y0 < 0) Y0 = 0;
+        if (X1 >= MAP -> Width) X1 = MAP -> Width - 1;
+        if (Y1 >= MAP -> Height) Y1 = MAP -> Height - 1;
+
+        for (int y=Y0; y <= Y1; y++) {
+            for (int x=X0; x <= X1; x++) {
+                if (!Jubi__TileSolid2D(MAP, x, y)) continue;
+
+                float MIN_X = MAP -> Origin.x + (float)x * MAP -> TileSize;
+                float MIN_Y = MAP -> Origin.y + (float)y * MAP -> TileSize;
+
+                // How far the body would have to move out through each face
+                float LEFT = BODY -> Bounds.Max.x - MIN_X;
+                float RIGHT = MIN_X + MAP -> TileSize - BODY -> Bounds.Min.x;
+                float UP = BODY -> Bounds.Max.y - MIN_Y;
+                float DOWN = MIN_Y + MAP -> TileSize - BODY -> Bounds.Min.y;
+
+                // Earlier tiles may have already pushed the body clear of this one
+                if (LEFT <= 0.0f || RIGHT <= 0.0f || UP <= 0.0f || DOWN <= 0.0f) continue;
+
+                float BEST = INFINITY;
+                Vector2 NORMAL = {0, 0}; // Out of the tile
+
+                if (!Jubi__TileSolid2D(MAP, x - 1, y) && LEFT < BEST) { BEST = LEFT; NORMAL = (Vector2){-1, 0}; }
+                if (!Jubi__TileSolid2D(MAP, x + 1, y) && RIGHT < BEST) { BEST = RIGHT; NORMAL = (Vector2){1, 0}; }
+                if (!Jubi__TileSolid2D(MAP, x, y - 1) && UP < BEST) { BEST = UP; NORMAL = (Vector2){0, -1}; }
+                if (!Jubi__TileSolid2D(MAP, x, y + 1) && DOWN < BEST) { BEST = DOWN; NORMAL = (Vector2){0, 1}; }
+
+                // Buried in solid tiles, the surrounding tiles will push it out
+                if (BEST == INFINITY) continue;
+
+                BODY -> Position = JVector2_Add(BODY -> Position, JVector2_Scale(NORMAL, BEST));
+
+                float INTO = JVector2_Dot(BODY -> Velocity, NORMAL);
+                if (INTO < 0.0f) BODY -> Velocity = JVector2_Subtract(BODY -> Velocity, JVector2_Scale(NORMAL, INTO));
+
+                Jubi__UpdateBounds2D(BODY);
+            }
+        }
+    }
+
+    static void Jubi__CollideTilemaps2D(JubiWorld2D *WORLD) {
+        for (int m=0; m < JUBI_MAX_TILEMAPS; m++) {
+            const JubiTilemap2D *MAP = &WORLD -> Tilemaps[m];
+            if (MAP -> Tiles == NULL) continue;
+
+            for (int i=0; i < WORLD -> BodyCount; i++) {
+                Body2D *BODY = &WORLD -> Bodies[i];
+
+                if (BODY -> Type == BODY_DYNAMIC && BODY -> InvMass > 0.0f && !(BODY -> Flags & (JUBI_BODY_HELD | JUBI_BODY_SENSOR))) Jubi__CollideTilemap2D(MAP, BODY);
+            }
+        }
+    }
+
+    // Particles
+
+    int Jubi_ReserveParticles2D(JubiWorld2D *WORLD, int CAPACITY) {
+        Jubi__IncrementErrorTick();
+
+        if (Jubi_IsWorldValid(WORLD) != 1) {
+            Jubi__SetError(Jubi_GetWorldError(Jubi_IsWorldValid(WORLD)), __func__);
+
+            return -1;
+        } else if (CAPACITY < 0) {
+            Jubi__SetError(JUBI_ERROR_INVALID_VALUE, __func__);
+
+            return -1;
+        }
+
+        return Jubi__GrowParticles2D(&WORLD -> Particles, CAPACITY) ? 1 : -1;
+    }
+
+    // VELOCITIES may be NULL to start them still. LIFETIME is in seconds, <= 0 lives until killed. Returns the index of the first new particle.
+    int Jubi_EmitParticles2D(JubiWorld2D *WORLD, const Vector2 *POSITIONS, const Vector2 *VELOCITIES, int COUNT, float LIFETIME) {
+        Jubi__IncrementErrorTick();
+
+        if (Jubi_IsWorldValid(WORLD) != 1) {
+            Jubi__SetError(Jubi_GetWorldError(Jubi_IsWorldValid(WORLD)), __func__);
+
+            return -1;
+        } else if (POSITIONS == NULL || COUNT < 0) {
+            Jubi__SetError(JUBI_ERROR_NULL_VALUE, __func__);
+
+            return -1;
+        }
+
+        JubiParticles2D *PARTICLES = &WORLD -> Particles;
+        int FIRST = PARTICLES -> Count;
+
+        if (FIRST + COUNT > PARTICLES -> Capacity) {
+            int GROWN = PARTICLES -> Capacity * 2 > FIRST + COUNT ? PARTICLES -> Capacity * 2 : FIRST + COUNT;
+
+            if (!Jubi__GrowParticles2D(PARTICLES, GROWN)) {
+                Jubi__SetError(JUBI_ERROR_WORLD_FULL, __func__);
+
+                return -1;
+            }
+        }
+
+        float LIFE = LIFETIME > 0.0f ? LIFETIME : INFINITY;
+
+        for (int i=0; i < COUNT; i++) {
+            PARTICLES -> X[FIRST + i] = POSITIONS[i].x;
+            PARTICLES -> Y[FIRST + i] = POSITIONS[i].y;
+            PARTICLES -> VX[FIRST + i] = VELOCITIES ? VELOCITIES[i].x : 0.0f;
+            PARTICLES -> VY[FIRST + i] = VELOCITIES ? VELOCITIES[i].y : 0.0f;
+            PARTICLES -> Life[FIRST + i] = LIFE;
+        }
+
+        PARTICLES -> Count += COUNT;
+
+        if (LIFETIME > 0.0f) PARTICLES -> _Mortal = 1;
+
+        return FIRST;
+    }
+
+    // The last particles are moved into the gaps, so indices past the first killed one change
+    int Jubi_KillParticles2D(JubiWorld2D *WORLD, const int *INDICES, int COUNT) {
+        Jubi__IncrementErrorTick();
+
+        if (Jubi_IsWorldValid(WORLD) != 1) {
+            Jubi__SetError(Jubi_GetWorldError(Jubi_IsWorldValid(WORLD)), __func__);
+
+            return -1;
+        } else if (INDICES == NULL && COUNT > 0) {
+            Jubi__SetError(JUBI_ERROR_NULL_VALUE, __func__);
+
+            return -1;
+        }
+
+        JubiParticles2D *PARTICLES = &WORLD -> Particles;
+
+        // Mark first, so the indices stay valid until every one has been seen
+        for (int i=0; i < COUNT; i++)
+            if (INDICES[i] >= 0 && INDICES[i] < PARTICLES -> Count) PARTICLES -> Life[INDICES[i]] = 0.0f;
+
+        int BEFORE = PARTICLES -> Count;
+
+        Jubi__CompactParticles2D(PARTICLES);
+
+        return BEFORE - PARTICLES -> Count;
+    }
+
+    void Jubi_ClearParticles2D(JubiWorld2D *WORLD) {
+        if (Jubi_IsWorldValid(WORLD) != 1) return;
+
+        WORLD -> Particles.Count = 0;
+        WORLD -> Particles._Mortal = 0;
+    }
+
+    static int Jubi__GrowParticles2D(JubiParticles2D *PARTICLES, int CAPACITY) {
+        if (CAPACITY <= PARTICLES -> Capacity) return 1;
+
+        float **ARRAYS[5] = {&PARTICLES -> X, &PARTICLES -> Y, &PARTICLES -> VX, &PARTICLES -> VY, &PARTICLES -> Life};
+
+        for (int i=0; i < 5; i++) {
+            float *GROWN = (float *)JUBI_REALLOC(*ARRAYS[i], sizeof(float) * (size_t)CAPACITY);
+
+            // The arrays grown so far stay valid (& bigger), Capacity only moves once they all are
+            if (GROWN == NULL) return 0;
+
+            *ARRAYS[i] = GROWN;
+        }
+
+        PARTICLES -> Capacity = CAPACITY;
+
+        return 1;
+    }
+
+    static void Jubi__FreeParticles2D(JubiParticles2D *PARTICLES) {
+        JUBI_FREE(PARTICLES -> X);
+        JUBI_FREE(PARTICLES -> Y);
+        JUBI_FREE(PARTICLES -> VX);
+        JUBI_FREE(PARTICLES -> VY);
+        JUBI_FREE(PARTICLES -> Life);
+
+        float RESTITUTION = PARTICLES -> Restitution;
+
+        *PARTICLES = (JubiParticles2D){0};
+        PARTICLES -> Restitution = RESTITUTION;
+    }
+
+    // Removes every particle with no life left
+    static void Jubi__CompactParticles2D(JubiParticles2D *PARTICLES) {
+        int MORTAL = 0;
+
+        for (int i=0; i < PARTICLES -> Count; ) {
+            if (PARTICLES -> Life[i] > 0.0f) {
+                MORTAL |= PARTICLES -> Life[i] != INFINITY;
+                i++;
+
+                continue;
+            }
+
+            int LAST = --PARTICLES -> Count;
+
+            PARTICLES -> X[i] = PARTICLES -> X[LAST];
+            PARTICLES -> Y[i] = PARTICLES -> Y[LAST];
+            PARTICLES -> VX[i] = PARTICLES -> VX[LAST];
+            PARTICLES -> VY[i] = PARTICLES -> VY[LAST];
+            PARTICLES -> Life[i] = PARTICLES -> Life[LAST];
+        }
+
+        PARTICLES -> _Mortal = MORTAL;
+    }
+
+    typedef struct {
+        JubiWorld2D *WORLD;
+        float DeltaTime;
+        float Drag;
+
+        const AABB *STATICS; // By Min.x
+        int STATIC_COUNT;
+        float STATIC_WIDTH; // Widest static on X
+        AABB STATIC_BOUNDS; // Around every static, most particles never get near one
+    } Jubi__ParticleBatch2D;
+
+    static void Jubi__IntegrateParticles2D(const Jubi__ParticleBatch2D *BATCH, int START, int END) {
+        JubiParticles2D *PARTICLES = &BATCH -> WORLD -> Particles;
+
+        float *X = PARTICLES -> X, *Y = PARTICLES -> Y, *VX = PARTICLES -> VX, *VY = PARTICLES -> VY, *LIFE = PARTICLES -> Life;
+
+        float DT = BATCH -> DeltaTime;
+        float FALL = BATCH -> WORLD -> Gravity * DT;
+        float DRAG = BATCH -> Drag;
+
+        int i = START;
+
+        #if defined(JUBI_SIMD_SSE)
+            __m128 DT4 = _mm_set1_ps(DT), FALL4 = _mm_set1_ps(FALL), DRAG4 = _mm_set1_ps(DRAG);
+
+            for (; i + 4 <= END; i += 4) {
+                __m128 VX4 = _mm_mul_ps(_mm_loadu_ps(&VX[i]), DRAG4);
+                __m128 VY4 = _mm_mul_ps(_mm_add_ps(_mm_loadu_ps(&VY[i]), FALL4), DRAG4);
+
+                _mm_storeu_ps(&VX[i], VX4);
+                _mm_storeu_ps(&VY[i], VY4);
+                _mm_storeu_ps(&X[i], _mm_add_ps(_mm_loadu_ps(&X[i]), _mm_mul_ps(VX4, DT4)));
+                _mm_storeu_ps(&Y[i], _mm_add_ps(_mm_loadu_ps(&Y[i]), _mm_mul_ps(VY4, DT4)));
+                _mm_storeu_ps(&LIFE[i], _mm_sub_ps(_mm_loadu_ps(&LIFE[i]), DT4));
+            }
+        #elif defined(JUBI_SIMD_NEON)
+            for (; i + 4 <= END; i += 4) {
+                float32x4_t VX4 = vmulq_n_f32(vld1q_f32(&VX[i]), DRAG);
+                float32x4_t VY4 = vmulq_n_f32(vaddq_f32(vld1q_f32(&VY[i]), vdupq_n_f32(FALL)), DRAG);
+
+                vst1q_f32(&VX[i], VX4);
+                vst1q_f32(&VY[i], VY4);
+                vst1q_f32(&X[i], vaddq_f32(vld1q_f32(&X[i]), vmulq_n_f32(VX4, DT)));
+                vst1q_f32(&Y[i], vaddq_f32(vld1q_f32(&Y[i]), vmulq_n_f32(VY4, DT)));
+                vst1q_f32(&LIFE[i], vsubq_f32(vld1q_f32(&LIFE[i]), vdupq_n_f32(DT)));
+            }
+        #endif
+
+        for (; i < END; i++) {
+            VX[i] *= DRAG;
+            VY[i] = (VY[i] + FALL) * DRAG;
+            X[i] += VX[i] * DT;
+            Y[i] += VY[i] * DT;
+            LIFE[i] -= DT;
+        }
+    }
+
+    // Particles are points, pushed out of a static body through the nearest face of its bounds, & bounced by Restitution
+    static void Jubi__CollideParticleStatics2D(const Jubi__ParticleBatch2D *BATCH, int INDEX) {
+        JubiParticles2D *PARTICLES = &BATCH -> WORLD -> Particles;
+
+        float X = PARTICLES -> X[INDEX];
+        float Y = PARTICLES -> Y[INDEX];
+
+        if (X < BATCH -> STATIC_BOUNDS.Min.x || X > BATCH -> STATIC_BOUNDS.Max.x || Y < BATCH -> STATIC_BOUNDS.Min.y || Y > BATCH -> STATIC_BOUNDS.Max.y) return;
+
+        // Last static starting at or before X, anything that could still reach X is within STATIC_WIDTH before it
+        int LOW = 0, HIGH = BATCH -> STATIC_COUNT;
+
+        while (LOW < HIGH) {
+            int MIDDLE = (LOW + HIGH) / 2;
+
+            if (BATCH -> STATICS[MIDDLE].Min.x <= X) LOW = MIDDLE + 1;
+            else HIGH = MIDDLE;
+        }
+
+        for (int s = LOW - 1; s >= 0 && BATCH -> STATICS[s].Min.x >= X - BATCH -> STATIC_WIDTH; s--) {
+            const AABB *BOX = &BATCH -> STATICS[s];
+
+            if (X <= BOX -> Min.x || X >= BOX -> Max.x || Y <= BOX -> Min.y || Y >= BOX -> Max.y) continue;
+
+            float LEFT = X - BOX -> Min.x, RIGHT = BOX -> Max.x - X;
+            float UP = Y - BOX -> Min.y, DOWN = BOX -> Max.y - Y;
+            float BOUNCE = -PARTICLES -> Restitution;
+
+            if (fminf(LEFT, RIGHT) < fminf(UP, DOWN)) {
+                X = LEFT < RIGHT ? BOX -> Min.x : BOX -> Max.x;
+
+                if ((LEFT < RIGHT) == (PARTICLES -> VX[INDEX] > 0.0f)) PARTICLES -> VX[INDEX] *= BOUNCE;
+            } else {
+                Y = UP < DOWN ? BOX -> Min.y : BOX -> Max.y;
+
+                if ((UP < DOWN) == (PARTICLES -> VY[INDEX] > 0.0f)) PARTICLES -> VY[INDEX] *= BOUNCE;
+            }
+        }
+
+        PARTICLES -> X[INDEX] = X;
+        PARTICLES -> Y[INDEX] = Y;
+    }
+
+    // Uses where the particle came from to tell which face of the tile it went through
+    static void Jubi__CollideParticleTiles2D(const Jubi__ParticleBatch2D *BATCH, const JubiTilemap2D *MAP, int INDEX) {
+        JubiParticles2D *PARTICLES = &BATCH -> WORLD -> Particles;
+
+        float INV_SIZE = 1.0f / MAP -> TileSize;
+        float X = PARTICLES -> X[INDEX], Y = PARTICLES -> Y[INDEX];
+
+        int TX = (int)floorf((X - MAP -> Origin.x) * INV_SIZE);
+        int TY = (int)floorf((Y - MAP -> Origin.y) * INV_SIZE);
+
+        if (!Jubi__TileSolid2D(MAP, TX, TY)) return;
+
+        float VX = PARTICLES -> VX[INDEX], VY = PARTICLES -> VY[INDEX];
+
+        int FROM_X = (int)floorf((X - VX * BATCH -> DeltaTime - MAP -> Origin.x) * INV_SIZE);
+        int FROM_Y = (int)floorf((Y - VY * BATCH -> DeltaTime - MAP -> Origin.y) * INV_SIZE);
+
+        if (FROM_Y != TY && !Jubi__TileSolid2D(MAP, TX, FROM_Y)) {
+            PARTICLES -> Y[INDEX] = MAP -> Origin.y + (float)(FROM_Y < TY ? TY : TY + 1) * MAP -> TileSize;
+            PARTICLES -> VY[INDEX] = VY * -PARTICLES -> Restitution;
+        } else if (FROM_X != TX && !Jubi__TileSolid2D(MAP, FROM_X, TY)) {
+            PARTICLES -> X[INDEX] = MAP -> Origin.x + (float)(FROM_X < TX ? TX : TX + 1) * MAP -> TileSize;
+            PARTICLES -> VX[INDEX] = VX * -PARTICLES -> Restitution;
+        } else {
+            // Came in diagonally or from inside, send it back where it was
+            PARTICLES -> X[INDEX] = X - VX * BATCH -> DeltaTime;
+            PARTICLES -> Y[INDEX] = Y - VY * BATCH -> DeltaTime;
+            PARTICLES -> VX[INDEX] = VX * -PARTICLES -> Restitution;
+            PARTICLES -> VY[INDEX] = VY * -PARTICLES -> Restitution;
+        }
+    }
+
+    static void Jubi__StepParticleTask2D(void *DATA, int INDEX) {
+        const Jubi__ParticleBatch2D *BATCH = (const Jubi__ParticleBatch2D *)DATA;
+        JubiWorld2D *WORLD = BATCH -> WORLD;
+
+        int START = INDEX * JUBI_PARTICLE_TASK_SIZE;
+        int END = START + JUBI_PARTICLE_TASK_SIZE < WORLD -> Particles.Count ? START + JUBI_PARTICLE_TASK_SIZE : WORLD -> Particles.Count;
+
+        Jubi__IntegrateParticles2D(BATCH, START, END);
+
+        if (BATCH -> STATIC_COUNT > 0) {
+            for (int i=START; i < END; i++)
+                Jubi__CollideParticleStatics2D(BATCH, i);
+        }
+
+        for (int m=0; m < JUBI_MAX_TILEMAPS; m++) {
+            if (WORLD -> Tilemaps[m].Tiles == NULL) continue;
+
+            for (int i=START; i < END; i++)
+                Jubi__CollideParticleTiles2D(BATCH, &WORLD -> Tilemaps[m], i);
+        }
+    }
+
+    // Particles only collide one way with the static world, never with each other or dynamic bodies
+    static void Jubi__StepParticles2D(JubiWorld2D *WORLD, float DeltaTime) {
+        JubiParticles2D *PARTICLES = &WORLD -> Particles;
+        if (PARTICLES -> Count == 0) return;
+
+        Jubi__ParticleBatch2D BATCH = {WORLD, DeltaTime, 1.0f - AIR_RESISTANCE, NULL, 0, 0.0f, {{INFINITY, INFINITY}, {-INFINITY, -INFINITY}}};
+
+        // The broadphase order is already by Min.x, pick the statics out of it
+        Jubi__UpdateBroadphase2D(WORLD);
+
+        AABB *STATICS = (AABB *)Jubi__ArenaAlloc(&WORLD -> Scratch, sizeof(AABB) * (WORLD -> BodyCount > 0 ? WORLD -> BodyCount : 1));
+
+        // Out of memory, particles only bounce off tilemaps this step
+        for (int i=0; STATICS && i < WORLD -> _SortedCount; i++) {
+            const Body2D *BODY = &WORLD -> Bodies[WORLD -> _SortedBodies[i]];
+            if (BODY -> Type != BODY_STATIC || (BODY -> Flags & JUBI_BODY_SENSOR)) continue;
+
+            STATICS[BATCH.STATIC_COUNT++] = BODY -> Bounds;
+
+            BATCH.STATIC_WIDTH = fmaxf(BATCH.STATIC_WIDTH, BODY -> Bounds.Max.x - BODY -> Bounds.Min.x);
+            BATCH.STATIC_BOUNDS.Min.x = fminf(BATCH.STATIC_BOUNDS.Min.x, BODY -> Bounds.Min.x);
+            BATCH.STATIC_BOUNDS.Min.y = fminf(BATCH.STATIC_BOUNDS.Min.y, BODY -> Bounds.Min.y);
+            BATCH.STATIC_BOUNDS.Max.x = fmaxf(BATCH.STATIC_BOUNDS.Max.x, BODY -> Bounds.Max.x);
+            BATCH.STATIC_BOUNDS.Max.y = fmaxf(BATCH.STATIC_BOUNDS.Max.y, BODY -> Bounds.Max.y);
+        }
+
+        BATCH.STATICS = STATICS;
+
+        Jubi__RunTasks(Jubi__StepParticleTask2D, &BATCH, (PARTICLES -> Count + JUBI_PARTICLE_TASK_SIZE - 1) / JUBI_PARTICLE_TASK_SIZE);
+
+        if (PARTICLES -> _Mortal) Jubi__CompactParticles2D(PARTICLES);
+    }
+
+    // Streaming
+
+    // CHUNK_SIZE only groups unloaded bodies for storage. Bodies within ACTIVE_RADIUS of an observer are simulated, out to LOAD_RADIUS they're frozen in place, & past that they're unloaded out of the world.
+    int Jubi_EnableStreaming2D(JubiWorld2D *WORLD, float CHUNK_SIZE, float ACTIVE_RADIUS, float LOAD_RADIUS) {
+        Jubi__IncrementErrorTick();
+
+        if (Jubi_IsWorldValid(WORLD) != 1) {
+            Jubi__SetError(Jubi_GetWorldError(Jubi_IsWorldValid(WORLD)), __func__);
+
+            return -1;
+        } else if (CHUNK_SIZE <= 0.0f || ACTIVE_RADIUS < 0.0f || LOAD_RADIUS < ACTIVE_RADIUS) {
+            Jubi__SetError(JUBI_ERROR_INVALID_VALUE, __func__);
+
+            return -1;
+        }
+
+        JubiStreaming2D *STREAMING = &WORLD -> Streaming;
+
+        STREAMING -> ChunkSize = CHUNK_SIZE;
+        STREAMING -> ActiveRadius = ACTIVE_RADIUS;
+        STREAMING -> LoadRadius = LOAD_RADIUS;
+        STREAMING -> Enabled = 1;
+
+        return 1;
+    }
+
+    // Loads every stored chunk back in (as far as there's room) & thaws every body
+    int Jubi_DisableStreaming2D(JubiWorld2D *WORLD) {
+        Jubi__IncrementErrorTick();
+
+        if (Jubi_IsWorldValid(WORLD) != 1) {
+            Jubi__SetError(Jubi_GetWorldError(Jubi_IsWorldValid(WORLD)), __func__);
+
+            return -1;
+        }
+
+        JubiStreaming2D *STREAMING = &WORLD -> Streaming;
+
+        for (int c = STREAMING -> _ChunkCount - 1; c >= 0; c--)
+            Jubi__LoadChunk2D(WORLD, c);
+
+        for (int i=0; i < WORLD -> BodyCount; i++)
+            WORLD -> Bodies[i].Flags &= ~JUBI_BODY_FROZEN;
+
+        STREAMING -> Enabled = 0;
+
+        return STREAMING -> _ChunkCount == 0 ? 1 : 0;
+    }
+
+    // Observers are the points the world is simulated around (players, cameras). With none set, nothing is streamed.
+    int Jubi_SetObservers2D(JubiWorld2D *WORLD, const Vector2 *POSITIONS, int COUNT) {
+        Jubi__IncrementErrorTick();
+
+        if (Jubi_IsWorldValid(WORLD) != 1) {
+            Jubi__SetError(Jubi_GetWorldError(Jubi_IsWorldValid(WORLD)), __func__);
+
+            return -1;
+        } else if ((POSITIONS == NULL && COUNT > 0) || COUNT < 0 || COUNT > JUBI_MAX_OBSERVERS) {
+            Jubi__SetError(JUBI_ERROR_INVALID_VALUE, __func__);
+
+            return -1;
+        }
+
+        for (int i=0; i < COUNT; i++)
+            WORLD -> Observers[i] = POSITIONS[i];
+
+        WORLD -> ObserverCount = COUNT;
+
+        return 1;
+    }
+
+    // For filling a map bigger than the world can hold. Bodies near an observer go straight into the world, the rest are stored in their chunk until an observer comes close. Returns 1 if the body was added, 0 if it was stored.
+    int Jubi_StreamBody2D(JubiWorld2D *WORLD, const Body2D *BODY) {
+        Jubi__IncrementErrorTick();
+
+        if (Jubi_IsWorldValid(WORLD) != 1) {
+            Jubi__SetError(Jubi_GetWorldError(Jubi_IsWorldValid(WORLD)), __func__);
+
+            return -1;
+        } else if (BODY == NULL) {
+            Jubi__SetError(JUBI_ERROR_NULL_BODY, __func__);
+
+            return -1;
+        }
+
+        Body2D COPY = *BODY;
+
+        COPY.WORLD = WORLD;
+        Jubi__UpdateBounds2D(&COPY);
+
+        JubiStreaming2D *STREAMING = &WORLD -> Streaming;
+
+        if (!STREAMING -> Enabled || WORLD -> ObserverCount == 0 || Jubi__ObserverDistanceSq2D(WORLD, COPY.Bounds) <= STREAMING -> LoadRadius * STREAMING -> LoadRadius)
+            return Jubi_AddBodyToWorld(WORLD, &COPY) < 0 ? -1 : 1;
+
+        if (!Jubi__StoreBody2D(WORLD, &COPY)) {
+            Jubi__SetError(JUBI_ERROR_NULL_VALUE, __func__);
+
+            return -1;
+        }
+
+        return 0;
+    }
+
+    // Squared distance from the closest observer to AREA, 0 inside it
+    static float Jubi__ObserverDistanceSq2D(const JubiWorld2D *WORLD, AABB AREA) {
+        float CLOSEST = INFINITY;
+
+        for (int i=0; i < WORLD -> ObserverCount; i++) {
+            Vector2 POINT = WORLD -> Observers[i];
+
+            // Plain compares, fmaxf/fminf are library calls without fast math
+            float DX = AREA.Min.x > POINT.x ? AREA.Min.x - POINT.x : (POINT.x > AREA.Max.x ? POINT.x - AREA.Max.x : 0.0f);
+            float DY = AREA.Min.y > POINT.y ? AREA.Min.y - POINT.y : (POINT.y > AREA.Max.y ? POINT.y - AREA.Max.y : 0.0f);
+
+            float DISTANCE = DX * DX + DY * DY;
+            if (DISTANCE < CLOSEST) CLOSEST = DISTANCE;
+        }
+
+        return CLOSEST;
+    }
+
+    static int Jubi__StoreBody2D(JubiWorld2D *WORLD, const Body2D *BODY) {
+        JubiStreaming2D *STREAMING = &WORLD -> Streaming;
+
+        Vector2 CENTER = {(BODY -> Bounds.Min.x + BODY -> Bounds.Max.x) * 0.5f, (BODY -> Bounds.Min.y + BODY -> Bounds.Max.y) * 0.5f};
+
+        int X = (int)floorf(CENTER.x / STREAMING -> ChunkSize);
+        int Y = (int)floorf(CENTER.y / STREAMING -> ChunkSize);
+
+        JubiChunk2D *CHUNK = NULL;
+
+        for (int c=0; c < STREAMING -> _ChunkCount; c++) {
+            if (STREAMING -> _Chunks[c].X == X && STREAMING -> _Chunks[c].Y == Y) {
+                CHUNK = &STREAMING -> _Chunks[c];
+
+                break;
+            }
+        }
+
+        if (CHUNK == NULL) {
+            if (STREAMING -> _ChunkCount == STREAMING -> _ChunkCapacity) {
+                int CAPACITY = STREAMING -> _ChunkCapacity ? STREAMING -> _ChunkCapacity * 2 : 16;
+                JubiChunk2D *GROWN = (JubiChunk2D *)JUBI_REALLOC(STREAMING -> _Chunks, sizeof(JubiChunk2D) * (size_t)CAPACITY);
+
+                if (GROWN == NULL) return 0;
+
+                STREAMING -> _Chunks = GROWN;
+                STREAMING -> _ChunkCapacity = CAPACITY;
+            }
+
+            CHUNK = &STREAMING -> _Chunks[STREAMING -> _ChunkCount++];
+
+            *CHUNK = (JubiChunk2D){0};
+            CHUNK -> X = X;
+            CHUNK -> Y = Y;
+            CHUNK -> Bounds = BODY -> Bounds;
+        }
+
+        if (CHUNK -> Count == CHUNK -> Capacity) {
+            int CAPACITY = CHUNK -> Capacity ? CHUNK -> Capacity * 2 : 8;
+            Body2D *GROWN = (Body2D *)JUBI_REALLOC(CHUNK -> Bodies, sizeof(Body2D) * (size_t)CAPACITY);
+
+            if (GROWN == NULL) return 0;
+
+            CHUNK -> Bodies = GROWN;
+            CHUNK -> Capacity = CAPACITY;
+        }
+
+        Body2D *STORED = &CHUNK -> Bodies[CHUNK -> Count++];
+
+        *STORED = *BODY;
+        STORED -> Flags &= ~JUBI_BODY_HELD;
+        STORED -> Tier = 0;
+        STORED -> _Skipped = 0.0f;
+        STORED -> _ContactTier = 0;
+        STORED -> Index = -1;
+        STORED -> Handle = JUBI_INVALID_HANDLE;
+
+        Jubi__GrowBounds2D(&CHUNK -> Bounds, BODY -> Bounds);
+
+        STREAMING -> Unloaded++;
+
+        return 1;
+    }
+
+    // Moves the bodies of chunk C within LoadRadius back into the world (new handles), & drops the chunk once it's empty. The chunk's bounds can reach an observer while every body in it is still far away, those stay stored, or they'd be loaded & unloaded again every step.
+    static void Jubi__LoadChunk2D(JubiWorld2D *WORLD, int C) {
+        JubiStreaming2D *STREAMING = &WORLD -> Streaming;
+        JubiChunk2D *CHUNK = &STREAMING -> _Chunks[C];
+
+        float LOAD_SQ = STREAMING -> LoadRadius * STREAMING -> LoadRadius;
+
+        int KEPT = 0;
+        AABB BOUNDS = {{INFINITY, INFINITY}, {-INFINITY, -INFINITY}};
+
+        for (int i = CHUNK -> Count - 1; i >= 0; i--) {
+            if (WORLD -> BodyCount >= JUBI_MAX_BODIES || Jubi__ObserverDistanceSq2D(WORLD, CHUNK -> Bodies[i].Bounds) > LOAD_SQ) {
+                Jubi__GrowBounds2D(&BOUNDS, CHUNK -> Bodies[i].Bounds);
+                KEPT++;
+
+                continue;
+            }
+
+            int INDEX = Jubi_AddBodyToWorld(WORLD, &CHUNK -> Bodies[i]);
+
+            CHUNK -> Bodies[i] = CHUNK -> Bodies[--CHUNK -> Count];
+            STREAMING -> Unloaded--;
+
+            if (STREAMING -> OnStream) STREAMING -> OnStream(STREAMING -> Context, &WORLD -> Bodies[INDEX], 1);
+        }
+
+        if (KEPT > 0) {
+            CHUNK -> Bounds = BOUNDS;
+
+            return;
+        }
+
+        JUBI_FREE(CHUNK -> Bodies);
+
+        STREAMING -> _Chunks[C] = STREAMING -> _Chunks[--STREAMING -> _ChunkCount];
+    }
+
+    static void Jubi__GrowBounds2D(AABB *BOUNDS, AABB OTHER) {
+        if (OTHER.Min.x < BOUNDS -> Min.x) BOUNDS -> Min.x = OTHER.Min.x;
+        if (OTHER.Min.y < BOUNDS -> Min.y) BOUNDS -> Min.y = OTHER.Min.y;
+        if (OTHER.Max.x > BOUNDS -> Max.x) BOUNDS -> Max.x = OTHER.Max.x;
+        if (OTHER.Max.y > BOUNDS -> Max.y) BOUNDS -> Max.y = OTHER.Max.y;
+    }
+
+    static void Jubi__FreeChunks2D(JubiStreaming2D *STREAMING) {
+        for (int c=0; c < STREAMING -> _ChunkCount; c++)
+            JUBI_FREE(STREAMING -> _Chunks[c].Bodies);
+
+        JUBI_FREE(STREAMING -> _Chunks);
+
+        STREAMING -> _Chunks = NULL;
+        STREAMING -> _ChunkCount = 0;
+        STREAMING -> _ChunkCapacity = 0;
+        STREAMING -> Unloaded = 0;
+    }
+
+    // Runs at the start of a step. Bodies are sorted into active/frozen/unloaded by their own bounds, not their chunk, so a long static floor stays loaded as long as any part of it is near an observer.
+    static void Jubi__UpdateStreaming2D(JubiWorld2D *WORLD) {
+        JubiStreaming2D *STREAMING = &WORLD -> Streaming;
+
+        STREAMING -> Active = 0;
+        STREAMING -> Frozen = 0;
+
+        if (!STREAMING -> Enabled || WORLD -> ObserverCount == 0) {
+            STREAMING -> Active = WORLD -> BodyCount;
+
+            return;
+        }
+
+        for (int c = STREAMING -> _ChunkCount - 1; c >= 0; c--) {
+            if (Jubi__ObserverDistanceSq2D(WORLD, STREAMING -> _Chunks[c].Bounds) <= STREAMING -> LoadRadius * STREAMING -> LoadRadius)
+                Jubi__LoadChunk2D(WORLD, c);
+        }
+
+        // A little past LoadRadius, so bodies right on the edge don't load & unload every step
+        float UNLOAD_RADIUS = STREAMING -> LoadRadius * JUBI_STREAM_HYSTERESIS;
+        float UNLOAD_SQ = UNLOAD_RADIUS * UNLOAD_RADIUS;
+        float ACTIVE_SQ = STREAMING -> ActiveRadius * STREAMING -> ActiveRadius;
+
+        int *LEAVING = NULL;
+        int LEAVING_COUNT = 0;
+
+        for (int i=0; i < WORLD -> BodyCount; i++) {
+            Body2D *BODY = &WORLD -> Bodies[i];
+            float DISTANCE = Jubi__ObserverDistanceSq2D(WORLD, BODY -> Bounds);
+
+            if (DISTANCE > UNLOAD_SQ) {
+                if (LEAVING == NULL) LEAVING = (int *)Jubi__ArenaAlloc(&WORLD -> Scratch, sizeof(int) * WORLD -> BodyCount);
+
+                // Out of memory, the body stays frozen in the world until a later step can unload it
+                if (LEAVING != NULL) {
+                    if (STREAMING -> OnStream) STREAMING -> OnStream(STREAMING -> Context, BODY, 0);
+
+                    if (Jubi__StoreBody2D(WORLD, BODY)) LEAVING[LEAVING_COUNT++] = BODY -> Handle;
+
+                    continue;
+                }
+            }
+
+            if (DISTANCE > ACTIVE_SQ) {
+                BODY -> Flags |= JUBI_BODY_FROZEN;
+                STREAMING -> Frozen++;
+            } else {
+                BODY -> Flags &= ~JUBI_BODY_FROZEN;
+                STREAMING -> Active++;
+            }
+        }
+
+        // Joints on them are dropped with the bodies, their handles are about to be handed out again
+        if (LEAVING_COUNT > 0) JBody2D_DestroyBatch(WORLD, LEAVING, LEAVING_COUNT);
+    }
+
+    // Frozen & waiting bodies hold still like statics, so they're resolved with no inverse mass & keep their velocity for when they move again
+    static void Jubi__ResolvePair2D(Body2D *A, Body2D *B, JUBI_UINT32 FEATURES) {
+        float INV_A = A -> InvMass, INV_B = B -> InvMass;
+        Vector2 VELOCITY_A = A -> Velocity, VELOCITY_B = B -> Velocity;
+
+        if (A -> Flags & JUBI_BODY_HELD) A -> InvMass = 0.0f;
+        if (B -> Flags & JUBI_BODY_HELD) B -> InvMass = 0.0f;
+
+        if ((FEATURES & JUBI_STEP_POLYGONS) && (A -> Shape == SHAPE_POLYGON || B -> Shape == SHAPE_POLYGON)) {
+            JubiManifold2D MANIFOLD;
+
+            if (Jubi__CollidePolygonBodies2D(A, B, &MANIFOLD))
+                JCollision_ResolveManifold(A, B, &MANIFOLD);
+        } else {
+            JCollision_ResolveAABBvsAABB(A, B);
+        }
+
+        if (A -> Flags & JUBI_BODY_HELD) { A -> InvMass = INV_A; A -> Velocity = VELOCITY_A; }
+        if (B -> Flags & JUBI_BODY_HELD) { B -> InvMass = INV_B; B -> Velocity = VELOCITY_B; }
+
+        // Kinematic bodies already have no inverse mass, but the AABB resolver zeroes velocity on both sides
+        if (A -> Type == BODY_KINEMATIC) A -> Velocity = VELOCITY_A;
+        if (B -> Type == BODY_KINEMATIC) B -> Velocity = VELOCITY_B;
+    }
+
+    // Level of Detail
+
+    // DISTANCES are the (increasing) distances from the nearest observer where each slower tier starts, so COUNT distances make COUNT + 1 tiers. Tier N is stepped every 2^N steps. A COUNT of 0 turns it off.
+    int Jubi_SetLODTiers2D(JubiWorld2D *WORLD, const float *DISTANCES, int COUNT) {
+        Jubi__IncrementErrorTick();
+
+        if (Jubi_IsWorldValid(WORLD) != 1) {
+            Jubi__SetError(Jubi_GetWorldError(Jubi_IsWorldValid(WORLD)), __func__);
+
+            return -1;
+        } else if ((DISTANCES == NULL && COUNT > 0) || COUNT < 0 || COUNT >= JUBI_MAX_LOD_TIERS) {
+            Jubi__SetError(JUBI_ERROR_INVALID_VALUE, __func__);
+
+            return -1;
+        }
+
+        for (int i=1; i < COUNT; i++) {
+            if (DISTANCES[i] <= DISTANCES[i - 1]) {
+                Jubi__SetError(JUBI_ERROR_INVALID_VALUE, __func__);
+
+                return -1;
+            }
+        }
+
+        for (int i=0; i < COUNT; i++)
+            WORLD -> LOD.Distances[i] = DISTANCES[i];
+
+        WORLD -> LOD.TierCount = COUNT + 1;
+
+        if (COUNT == 0) {
+            // Bodies that were waiting catch up on their next step
+            for (int i=0; i < WORLD -> BodyCount; i++) {
+                WORLD -> Bodies[i].Tier = 0;
+                WORLD -> Bodies[i].Flags &= ~JUBI_BODY_WAITING;
+            }
+        }
+
+        return 1;
+    }
+
+    // Picks each body's tier & whether it's stepped this time. Bodies are staggered by handle, so a tier's bodies are spread over its steps instead of all landing on the same one.
+    static void Jubi__UpdateLOD2D(JubiWorld2D *WORLD, float DeltaTime) {
+        JubiLOD2D *LOD = &WORLD -> LOD;
+
+        for (int t=0; t < JUBI_MAX_LOD_TIERS; t++)
+            LOD -> Counts[t] = 0;
+
+        if (LOD -> TierCount <= 1 || WORLD -> ObserverCount == 0) {
+            for (int i=0; i < WORLD -> BodyCount; i++) {
+                WORLD -> Bodies[i].Tier = 0;
+                WORLD -> Bodies[i].Flags &= ~JUBI_BODY_WAITING;
+            }
+
+            LOD -> Counts[0] = WORLD -> BodyCount;
+
+            return;
+        }
+
+        // Joints would be solved against bodies that aren't moving, keep both ends at the faster rate. Until they're recolored the active list is stale, so scan every slot.
+        int JOINT_COUNT = WORLD -> Joints == NULL ? 0 : WORLD -> _JointsDirty ? JUBI_MAX_JOINTS : WORLD -> _ColorStart[WORLD -> _ColorCount];
+
+        for (int j=0; j < JOINT_COUNT; j++) {
+            const JubiJoint2D *JOINT = &WORLD -> Joints[WORLD -> _JointsDirty ? j : WORLD -> _JointOrder[j]];
+            if (!JOINT -> Active) continue;
+
+            Body2D *A = Jubi__JointBody2D(WORLD, JOINT -> BodyA);
+            Body2D *B = Jubi__JointBody2D(WORLD, JOINT -> BodyB);
+
+            if (A && B) Jubi__PromoteContact2D(A, B);
+        }
+
+        float LIMITS[JUBI_MAX_LOD_TIERS - 1];
+
+        for (int t=0; t < LOD -> TierCount - 1; t++)
+            LIMITS[t] = LOD -> Distances[t] * LOD -> Distances[t];
+
+        for (int i=0; i < WORLD -> BodyCount; i++) {
+            Body2D *BODY = &WORLD -> Bodies[i];
+
+            BODY -> Flags &= ~JUBI_BODY_WAITING;
+
+            if (BODY -> Type != BODY_DYNAMIC || (BODY -> Flags & JUBI_BODY_FROZEN)) {
+                BODY -> Tier = 0;
+                BODY -> _ContactTier = 0;
+
+                continue;
+            }
+
+            float DISTANCE = Jubi__ObserverDistanceSq2D(WORLD, BODY -> Bounds);
+
+            int TIER = 0;
+            while (TIER < LOD -> TierCount - 1 && DISTANCE > LIMITS[TIER]) TIER++;
+
+            // Touched a faster body last step
+            if (BODY -> _ContactTier > 0 && BODY -> _ContactTier - 1 < TIER) TIER = BODY -> _ContactTier - 1;
+
+            BODY -> _ContactTier = 0;
+            BODY -> Tier = TIER;
+
+            LOD -> Counts[TIER]++;
+
+            unsigned int PERIOD = 1u << TIER;
+
+            if (((unsigned int)WORLD -> StepCount + (unsigned int)BODY -> Handle) & (PERIOD - 1)) {
+                BODY -> Flags |= JUBI_BODY_WAITING;
+                BODY -> _Skipped += DeltaTime;
+            }
+        }
+    }
+
+    // Contacts between tiers move the slower body up to the faster tier for the next step, so it answers the push instead of acting like a wall
+    static void Jubi__PromoteContact2D(Body2D *A, Body2D *B) {
+        if (A -> Tier == B -> Tier) return;
+
+        Body2D *SLOW = A -> Tier > B -> Tier ? A : B;
+        int FAST = A -> Tier > B -> Tier ? B -> Tier : A -> Tier;
+
+        if (SLOW -> _ContactTier == 0 || SLOW -> _ContactTier - 1 > FAST) SLOW -> _ContactTier = FAST + 1;
+    }
+
+    // Scratch Arena
+
+    // Hands the world MEMORY to use as its scratch arena instead of growing its own. Steps that need more than SIZE still work, but allocate the difference every step, check WORLD -> Scratch.HighWater to size it.
+    void Jubi_SetScratchMemory2D(JubiWorld2D *WORLD, void *MEMORY, size_t SIZE) {
+        Jubi__IncrementErrorTick();
+
+        if (Jubi_IsWorldValid(WORLD) != 1) {
+            Jubi__SetError(Jubi_GetWorldError(Jubi_IsWorldValid(WORLD)), __func__);
+
+            return;
+        } else if (MEMORY == NULL && SIZE > 0) {
+            Jubi__SetError(JUBI_ERROR_NULL_VALUE, __func__);
+
+            return;
+        }
+
+        size_t HIGH_WATER = WORLD -> Scratch.HighWater;
+
+        Jubi__FreeArena(&WORLD -> Scratch);
+
+        WORLD -> Scratch.Base = (unsigned char *)MEMORY;
+        WORLD -> Scratch.Capacity = SIZE;
+        WORLD -> Scratch.HighWater = HIGH_WATER;
+        WORLD -> Scratch.UserOwned = MEMORY != NULL;
+    }
+
+    static void Jubi__ResetArena(JubiArena *ARENA) {
+        while (ARENA -> _Overflow) {
+            void *NEXT = *(void **)ARENA -> _Overflow;
+
+            JUBI_FREE(ARENA -> _Overflow);
+            ARENA -> _Overflow = NEXT;
+        }
+
+        // Grow to fit the biggest step so far, with some headroom so a slowly growing scene doesn't reallocate every step
+        if (!ARENA -> UserOwned && ARENA -> HighWater > ARENA -> Capacity) {
+            size_t CAPACITY = ARENA -> HighWater + ARENA -> HighWater / 4;
+            unsigned char *BASE = (unsigned char *)JUBI_REALLOC(ARENA -> Base, CAPACITY);
+
+            if (BASE) {
+                ARENA -> Base = BASE;
+                ARENA -> Capacity = CAPACITY;
+            }
+        }
+
+        ARENA -> Offset = 0;
+        ARENA -> _Used = 0;
+    }
+
+    static void *Jubi__ArenaAlloc(JubiArena *ARENA, size_t SIZE) {
+        SIZE = (SIZE + JUBI_ARENA_ALIGNMENT - 1) & ~(size_t)(JUBI_ARENA_ALIGNMENT - 1);
+        if (SIZE == 0) SIZE = JUBI_ARENA_ALIGNMENT;
+
+        ARENA -> _Used += SIZE;
+        if (ARENA -> _Used > ARENA -> HighWater) ARENA -> HighWater = ARENA -> _Used;
+
+        if (ARENA -> Base && ARENA -> Offset + SIZE <= ARENA -> Capacity) {
+            void *POINTER = ARENA -> Base + ARENA -> Offset;
+
+            ARENA -> Offset += SIZE;
+
+            return POINTER;
+        }
+
+        // Doesn't fit, borrow from the heap until the next reset grows the arena. The block header is padded to keep the data aligned.
+        unsigned char *BLOCK = (unsigned char *)JUBI_MALLOC(JUBI_ARENA_ALIGNMENT + SIZE);
+        if (BLOCK == NULL) return NULL;
+
+        *(void **)BLOCK = ARENA -> _Overflow;
+        ARENA -> _Overflow = BLOCK;
+
+        return BLOCK + JUBI_ARENA_ALIGNMENT;
+    }
+
+    // Gives back everything allocated since MARK was copied from the arena, for work done outside a step that would otherwise pile up until the next reset
+    static void Jubi__RewindArena(JubiArena *ARENA, JubiArena MARK) {
+        while (ARENA -> _Overflow && ARENA -> _Overflow != MARK._Overflow) {
+            void *NEXT = *(void **)ARENA -> _Overflow;
+
+            JUBI_FREE(ARENA -> _Overflow);
+            ARENA -> _Overflow = NEXT;
+        }
+
+        ARENA -> Offset = MARK.Offset;
+        ARENA -> _Used = MARK._Used;
+    }
+
+    static void Jubi__FreeArena(JubiArena *ARENA) {
+        while (ARENA -> _Overflow) {
+            void *NEXT = *(void **)ARENA -> _Overflow;
+
+            JUBI_FREE(ARENA -> _Overflow);
+            ARENA -> _Overflow = NEXT;
+        }
+
+        if (!ARENA -> UserOwned) JUBI_FREE(ARENA -> Base);
+
+        *ARENA = (JubiArena){0};
+    }
+
+    // Transform Output
+
+    void Jubi_EnableTransformOutput2D(JubiWorld2D *WORLD, int ENABLED) {
+        Jubi__IncrementErrorTick();
+
+        if (Jubi_IsWorldValid(WORLD) != 1) {
+            Jubi__SetError(Jubi_GetWorldError(Jubi_IsWorldValid(WORLD)), __func__);
+
+            return;
+        }
+
+        if (ENABLED && WORLD -> Transforms.Frames == NULL) {
+            WORLD -> Transforms.Frames = (JubiTransformFrame2D *)JUBI_MALLOC(sizeof(JubiTransformFrame2D) * 3);
+
+            if (WORLD -> Transforms.Frames == NULL) {
+                Jubi__SetError(JUBI_ERROR_WORLD_FULL, __func__);
+
+                return;
+            }
+
+            for (int i=0; i < 3; i++) {
+                WORLD -> Transforms.Frames[i].Count = 0;
+                WORLD -> Transforms.Frames[i].Step = 0;
+            }
+        }
+
+        // The frames are in place before a reader can see output switched on
+        JUBI_ATOMIC_EXCHANGE(&WORLD -> Transforms.Enabled, ENABLED ? 1L : 0L);
+
+        // Publish straight away so readers see the current bodies before the first step
+        if (WORLD -> Transforms.Enabled) Jubi__PublishTransforms2D(WORLD);
+    }
+
+    // Safe to call from ONE reader thread while the simulation thread steps. It doesn't touch the error state, as that isn't shared safely across threads. The returned frame stays valid & unchanged until the next call.
+    const JubiTransformFrame2D *Jubi_AcquireTransforms2D(JubiWorld2D *WORLD) {
+        if (WORLD == NULL || !JUBI_ATOMIC_LOAD(&WORLD -> Transforms.Enabled)) return NULL;
+
+        JubiTransformBuffer2D *BUFFER = &WORLD -> Transforms;
+
+        if (JUBI_ATOMIC_LOAD(&BUFFER -> _Shared) & JUBI_TRANSFORM_FRESH) {
+            long PREVIOUS = JUBI_ATOMIC_EXCHANGE(&BUFFER -> _Shared, (long)BUFFER -> _Front);
+
+            BUFFER -> _Front = (int)(PREVIOUS & 3);
+        }
+
+        return &BUFFER -> Frames[BUFFER -> _Front];
+    }
+
+    static void Jubi__PublishTransforms2D(JubiWorld2D *WORLD) {
+        JubiTransformBuffer2D *BUFFER = &WORLD -> Transforms;
+        JubiTransformFrame2D *FRAME = &BUFFER -> Frames[BUFFER -> _Back];
+
+        for (int i=0; i < WORLD -> BodyCount; i++) {
+            FRAME -> Transforms[i].Position = WORLD -> Bodies[i].Position;
+            FRAME -> Transforms[i].Rotation = 0.0f;
+            FRAME -> Transforms[i].Handle = WORLD -> Bodies[i].Handle;
+        }
+
+        FRAME -> Count = WORLD -> BodyCount;
+        FRAME -> Step = WORLD -> StepCount;
+
+        long PREVIOUS = JUBI_ATOMIC_EXCHANGE(&BUFFER -> _Shared, (long)(BUFFER -> _Back | JUBI_TRANSFORM_FRESH));
+
+        BUFFER -> _Back = (int)(PREVIOUS & 3);
+    }
+
+    // Scheduling
+
+    static JubiScheduler Jubi_Scheduler = {NULL, NULL};
+
+    // Not thread-safe, set it once before stepping. NULL goes back to running tasks on the calling thread.
+    void Jubi_SetScheduler(const JubiScheduler *SCHEDULER) {
+        if (SCHEDULER == NULL || SCHEDULER -> Run == NULL) {
+            Jubi_Scheduler = (JubiScheduler){NULL, NULL};
+
+            return;
+        }
+
+        Jubi_Scheduler = *SCHEDULER;
+    }
+
+    // How many scheduler tasks this thread is inside of, so nested task lists (a grouped world solving its joints) never go back into the scheduler
+    static JUBI_THREAD_LOCAL int Jubi__TaskDepth = 0;
+
+    typedef struct {
+        JubiTaskFunction Task;
+        void *Data;
+    } Jubi__NestedTask;
+
+    static void Jubi__RunNestedTask(void *DATA, int INDEX) {
+        Jubi__NestedTask *NESTED = (Jubi__NestedTask *)DATA;
+
+        Jubi__TaskDepth++;
+        NESTED -> Task(NESTED -> Data, INDEX);
+        Jubi__TaskDepth--;
+    }
+
+    static void Jubi__RunTasks(JubiTaskFunction TASK, void *DATA, int COUNT) {
+        if (COUNT <= 0) return;
+
+        // Schedulers only run one job at a time, a task waiting on another job from inside one would never return
+        if (Jubi_Scheduler.Run != NULL && COUNT > 1 && Jubi__TaskDepth == 0) {
+            Jubi__NestedTask NESTED = {TASK, DATA};
+
+            Jubi_Scheduler.Run(Jubi_Scheduler.Context, Jubi__RunNestedTask, &NESTED, COUNT);
+
+            return;
+        }
+
+        for (int i=0; i < COUNT; i++)
+            TASK(DATA, i);
+    }
+
+    #ifdef JUBI_ENABLE_THREADS
+        #if defined(_WIN32)
+            #define JUBI__POOL_LOCK(POOL) AcquireSRWLockExclusive(&(POOL) -> Lock)
+            #define JUBI__POOL_UNLOCK(POOL) ReleaseSRWLockExclusive(&(POOL) -> Lock)
+            #define JUBI__POOL_WAIT(POOL, CONDITION) SleepConditionVariableSRW(&(POOL) -> CONDITION, &(POOL) -> Lock, INFINITE, 0)
+            #define JUBI__POOL_WAKE_ALL(POOL, CONDITION) WakeAllConditionVariable(&(POOL) -> CONDITION)
+        #else
+            #define JUBI__POOL_LOCK(POOL) pthread_mutex_lock(&(POOL) -> Lock)
+            #define JUBI__POOL_UNLOCK(POOL) pthread_mutex_unlock(&(POOL) -> Lock)
+            #define JUBI__POOL_WAIT(POOL, CONDITION) pthread_cond_wait(&(POOL) -> CONDITION, &(POOL) -> Lock)
+            #define JUBI__POOL_WAKE_ALL(POOL, CONDITION) pthread_cond_broadcast(&(POOL) -> CONDITION)
+        #endif
+
+        // Pulls task indices off the shared counter until the job runs dry
+        static void Jubi__DrainTasks(JubiThreadPool *POOL, JubiTaskFunction TASK, void *DATA, long COUNT) {
+            long INDEX;
+
+            while ((INDEX = JUBI_ATOMIC_ADD(&POOL -> _Next, 1)) < COUNT)
+                TASK(DATA, (int)INDEX);
+        }
+
+        #if defined(_WIN32)
+            static DWORD WINAPI Jubi__PoolWorker(LPVOID ARGUMENT) {
+        #else
+            static void *Jubi__PoolWorker(void *ARGUMENT) {
+        #endif
+            JubiThreadPool *POOL = (JubiThreadPool *)ARGUMENT;
+            JUBI_UINT64 SEEN = 0;
+
+            JUBI__POOL_LOCK(POOL);
+
+            for (;;) {
+                while (!POOL -> _Shutdown && POOL -> _Generation == SEEN)
+                    JUBI__POOL_WAIT(POOL, Wake);
+
+                if (POOL -> _Shutdown) break;
+
+                SEEN = POOL -> _Generation;
+
+                JubiTaskFunction TASK = POOL -> _Task;
+                void *DATA = POOL -> _Data;
+                long COUNT = POOL -> _Count;
+
+                JUBI__POOL_UNLOCK(POOL);
+
+                Jubi__DrainTasks(POOL, TASK, DATA, COUNT);
+
+                JUBI__POOL_LOCK(POOL);
+
+                if (--POOL -> _Busy == 0) JUBI__POOL_WAKE_ALL(POOL, Done);
+            }
+
+            JUBI__POOL_UNLOCK(POOL);
+
+            #if defined(_WIN32)
+                return 0;
+            #else
+                return NULL;
+            #endif
+        }
+
+        // THREADS is the number of worker threads, the thread calling Jubi_StepWorldGroup2D etc. helps out on top of these
+        JubiThreadPool *Jubi_CreateThreadPool(int THREADS) {
+            Jubi__IncrementErrorTick();
+
+            if (THREADS < 0 || THREADS > JUBI_MAX_THREADS) {
+                Jubi__SetError(JUBI_ERROR_INVALID_VALUE, __func__);
+
+                return NULL;
+            }
+
+            JubiThreadPool *POOL = (JubiThreadPool *)JUBI_MALLOC(sizeof(JubiThreadPool));
+
+            if (POOL == NULL) {
+                Jubi__SetError(JUBI_ERROR_NULL_VALUE, __func__);
+
+                return NULL;
+            }
+
+            *POOL = (JubiThreadPool){0};
+
+            #if defined(_WIN32)
+                InitializeSRWLock(&POOL -> Lock);
+                InitializeConditionVariable(&POOL -> Wake);
+                InitializeConditionVariable(&POOL -> Done);
+            #else
+                pthread_mutex_init(&POOL -> Lock, NULL);
+                pthread_cond_init(&POOL -> Wake, NULL);
+                pthread_cond_init(&POOL -> Done, NULL);
+            #endif
+
+            // A failed thread just means a smaller pool
+            for (int i=0; i < THREADS; i++) {
+                #if defined(_WIN32)
+                    POOL -> Threads[POOL -> ThreadCount] = CreateThread(NULL, 0, Jubi__PoolWorker, POOL, 0, NULL);
+
+                    if (POOL -> Threads[POOL -> ThreadCount] == NULL) break;
+                #else
+                    if (pthread_create(&POOL -> Threads[POOL -> ThreadCount], NULL, Jubi__PoolWorker, POOL) != 0) break;
+                #endif
+
+                POOL -> ThreadCount++;
+            }
+
+            return POOL;
+        }
+
+        void Jubi_DestroyThreadPool(JubiThreadPool *POOL) {
+            if (POOL == NULL) return;
+
+            JUBI__POOL_LOCK(POOL);
+            POOL -> _Shutdown = 1;
+            JUBI__POOL_WAKE_ALL(POOL, Wake);
+            JUBI__POOL_UNLOCK(POOL);
+
+            for (int i=0; i < POOL -> ThreadCount; i++) {
+                #if defined(_WIN32)
+                    WaitForSingleObject(POOL -> Threads[i], INFINITE);
+                    CloseHandle(POOL -> Threads[i]);
+                #else
+                    pthread_join(POOL -> Threads[i], NULL);
+                #endif
+            }
+
+            #if !defined(_WIN32)
+                pthread_cond_destroy(&POOL -> Done);
+                pthread_cond_destroy(&POOL -> Wake);
+                pthread_mutex_destroy(&POOL -> Lock);
+            #endif
+
+            JUBI_FREE(POOL);
+        }
+
+        JubiScheduler Jubi_ThreadPoolScheduler(JubiThreadPool *POOL) {
+            JubiScheduler SCHEDULER = {Jubi__ThreadPoolRun, POOL};
+
+            return SCHEDULER;
+        }
+
+        // Only one job runs at a time, Jubi__RunTasks keeps tasks from starting another one
+        static void Jubi__ThreadPoolRun(void *CONTEXT, JubiTaskFunction TASK, void *DATA, int COUNT) {
+            JubiThreadPool *POOL = (JubiThreadPool *)CONTEXT;
+
+            JUBI__POOL_LOCK(POOL);
+
+            while (POOL -> _Running)
+                JUBI__POOL_WAIT(POOL, Done);
+
+            POOL -> _Running = 1;
+            POOL -> _Task = TASK;
+            POOL -> _Data = DATA;
+            POOL -> _Count = COUNT;
+            POOL -> _Next = 0;
+            POOL -> _Busy = POOL -> ThreadCount;
+            POOL -> _Generation++;
+
+            JUBI__POOL_WAKE_ALL(POOL, Wake);
+            JUBI__POOL_UNLOCK(POOL);
+
+            Jubi__DrainTasks(POOL, TASK, DATA, COUNT);
+
+            JUBI__POOL_LOCK(POOL);
+
+            while (POOL -> _Busy > 0)
+                JUBI__POOL_WAIT(POOL, Done);
+
+            POOL -> _Running = 0;
+            JUBI__POOL_WAKE_ALL(POOL, Done);
+
+            JUBI__POOL_UNLOCK(POOL);
+        }
+    #endif
+
+    // Async Stepping
+
+    #ifdef JUBI_ENABLE_THREADS
+        // One background thread per world, started by the world's first async step
+        typedef struct {
+            #if defined(_WIN32)
+                HANDLE Thread;
+                SRWLOCK Lock;
+                CONDITION_VARIABLE Wake;
+                CONDITION_VARIABLE Done;
+            #else
+                pthread_t Thread;
+                pthread_mutex_t Lock;
+                pthread_cond_t Wake;
+                pthread_cond_t Done;
+            #endif
+
+            JubiWorld2D *World;
+            float DeltaTime;
+
+            int Pending; // A step was handed over & hasn't started yet
+            int Shutdown;
+        } Jubi__AsyncWorker2D;
+
+        #if defined(_WIN32)
+            static DWORD WINAPI Jubi__AsyncThread2D(LPVOID ARGUMENT) {
+        #else
+            static void *Jubi__AsyncThread2D(void *ARGUMENT) {
+        #endif
+            Jubi__AsyncWorker2D *WORKER = (Jubi__AsyncWorker2D *)ARGUMENT;
+
+            JUBI__POOL_LOCK(WORKER);
+
+            for (;;) {
+                while (!WORKER -> Shutdown && !WORKER -> Pending)
+                    JUBI__POOL_WAIT(WORKER, Wake);
+
+                if (WORKER -> Shutdown) break;
+
+                WORKER -> Pending = 0;
+                float DELTA_TIME = WORKER -> DeltaTime;
+
+                JUBI__POOL_UNLOCK(WORKER);
+
+                Jubi__StepWorld2D(WORKER -> World, DELTA_TIME, JUBI_STEP_ALL);
+
+                JUBI__POOL_LOCK(WORKER);
+
+                JUBI_ATOMIC_ADD(&WORKER -> World -> _AsyncDone, 1);
+                JUBI__POOL_WAKE_ALL(WORKER, Done);
+            }
+
+            JUBI__POOL_UNLOCK(WORKER);
+
+            #if defined(_WIN32)
+                return 0;
+            #else
+                return NULL;
+            #endif
+        }
+
+        static Jubi__AsyncWorker2D *Jubi__StartAsync2D(JubiWorld2D *WORLD) {
+            Jubi__AsyncWorker2D *WORKER = (Jubi__AsyncWorker2D *)JUBI_MALLOC(sizeof(Jubi__AsyncWorker2D));
+            if (WORKER == NULL) return NULL;
+
+            *WORKER = (Jubi__AsyncWorker2D){0};
+            WORKER -> World = WORLD;
+
+            #if defined(_WIN32)
+                InitializeSRWLock(&WORKER -> Lock);
+                InitializeConditionVariable(&WORKER -> Wake);
+                InitializeConditionVariable(&WORKER -> Done);
+
+                WORKER -> Thread = CreateThread(NULL, 0, Jubi__AsyncThread2D, WORKER, 0, NULL);
+
+                if (WORKER -> Thread == NULL) {
+                    JUBI_FREE(WORKER);
+
+                    return NULL;
+                }
+            #else
+                pthread_mutex_init(&WORKER -> Lock, NULL);
+                pthread_cond_init(&WORKER -> Wake, NULL);
+                pthread_cond_init(&WORKER -> Done, NULL);
+
+                if (pthread_create(&WORKER -> Thread, NULL, Jubi__AsyncThread2D, WORKER) != 0) {
+                    pthread_cond_destroy(&WORKER -> Done);
+                    pthread_cond_destroy(&WORKER -> Wake);
+                    pthread_mutex_destroy(&WORKER -> Lock);
+
+                    JUBI_FREE(WORKER);
+
+                    return NULL;
+                }
+            #endif
+
+            return WORKER;
+        }
+    #endif
+
+    // Starts a full step (like Jubi_StepWorld2D) on the world's background thread & returns straight away. Until the fence is done the world may only be used through Jubi_AcquireTransforms2D (the previous step's frame), Jubi_QueueForce2D & the fence functions. Starting another step waits for this one. Without JUBI_ENABLE_THREADS the step runs before this returns.
+    JubiStepFence2D Jubi_StepWorld2DAsync(JubiWorld2D *WORLD, float DeltaTime) {
+        Jubi__IncrementErrorTick();
+
+        JubiStepFence2D FENCE = {WORLD, 0};
+
+        if (Jubi_IsWorldValid(WORLD) < 1) {
+            Jubi__SetError(Jubi_GetWorldError(Jubi_IsWorldValid(WORLD)), __func__);
+
+            FENCE.World = NULL;
+
+            return FENCE;
+        }
+
+        Jubi__FinishAsync2D(WORLD);
+
+        FENCE.Ticket = ++WORLD -> _AsyncIssued;
+
+        #ifdef JUBI_ENABLE_THREADS
+            if (WORLD -> _AsyncWorker == NULL) WORLD -> _AsyncWorker = Jubi__StartAsync2D(WORLD);
+
+            Jubi__AsyncWorker2D *WORKER = (Jubi__AsyncWorker2D *)WORLD -> _AsyncWorker;
+
+            if (WORKER) {
+                JUBI__POOL_LOCK(WORKER);
+
+                WORKER -> DeltaTime = DeltaTime;
+                WORKER -> Pending = 1;
+
+                JUBI__POOL_WAKE_ALL(WORKER, Wake);
+                JUBI__POOL_UNLOCK(WORKER);
+
+                return FENCE;
+            }
+        #endif
+
+        // No thread to hand it to
+        Jubi__StepWorld2D(WORLD, DeltaTime, JUBI_STEP_ALL);
+        JUBI_ATOMIC_ADD(&WORLD -> _AsyncDone, 1);
+
+        return FENCE;
+    }
+
+    // 1 once the fenced step has finished, never blocks
+    int Jubi_PollStep2D(JubiStepFence2D FENCE) {
+        if (FENCE.World == NULL) return 1;
+
+        return JUBI_ATOMIC_LOAD(&FENCE.World -> _AsyncDone) >= FENCE.Ticket;
+    }
+
+    // Blocks until the fenced step has finished
+    void Jubi_WaitStep2D(JubiStepFence2D FENCE) {
+        if (Jubi_PollStep2D(FENCE)) return;
+
+        #ifdef JUBI_ENABLE_THREADS
+            Jubi__AsyncWorker2D *WORKER = (Jubi__AsyncWorker2D *)FENCE.World -> _AsyncWorker;
+
+            JUBI__POOL_LOCK(WORKER);
+
+            while (JUBI_ATOMIC_LOAD(&FENCE.World -> _AsyncDone) < FENCE.Ticket)
+                JUBI__POOL_WAIT(WORKER, Done);
+
+            JUBI__POOL_UNLOCK(WORKER);
+        #endif
+    }
+
+    // Safe from any thread, even while a step is running. The force is added to the body when the next step starts, for that step only (like JBody2D_ApplyForce), never to a step that's already running. Forces for handles that are gone by then are dropped.
+    int Jubi_QueueForce2D(JubiWorld2D *WORLD, int HANDLE, Vector2 FORCE) {
+        Jubi__IncrementErrorTick();
+
+        if (Jubi_IsWorldValid(WORLD) < 1) {
+            Jubi__SetError(Jubi_GetWorldError(Jubi_IsWorldValid(WORLD)), __func__);
+
+            return -1;
+        } else if (HANDLE < 0 || HANDLE >= JUBI_MAX_BODIES) {
+            Jubi__SetError(JUBI_ERROR_INVALID_VALUE, __func__);
+
+            return -1;
+        }
+
+        while (JUBI_ATOMIC_EXCHANGE(&WORLD -> _QueueLock, 1L)) {}
+
+        long COUNT = WORLD -> _QueuedCount;
+
+        if (COUNT < JUBI_MAX_QUEUED_FORCES) {
+            WORLD -> _QueuedForces[COUNT].Handle = HANDLE;
+            WORLD -> _QueuedForces[COUNT].Force = FORCE;
+
+            JUBI_ATOMIC_EXCHANGE(&WORLD -> _QueuedCount, COUNT + 1);
+        }
+
+        JUBI_ATOMIC_EXCHANGE(&WORLD -> _QueueLock, 0L);
+
+        if (COUNT >= JUBI_MAX_QUEUED_FORCES) {
+            Jubi__SetError(JUBI_ERROR_WORLD_FULL, __func__);
+
+            return -1;
+        }
+
+        return 1;
+    }
+
+    // Waits for the world's last async step & hands queued forces to their bodies, before anything that needs the world to itself (stepping, clearing). Forces are applied here rather than inside the step, so it's always the caller's thread that decides which step they land on.
+    static void Jubi__FinishAsync2D(JubiWorld2D *WORLD) {
+        if (WORLD -> _AsyncIssued > 0) {
+            JubiStepFence2D FENCE = {WORLD, WORLD -> _AsyncIssued};
+
+            Jubi_WaitStep2D(FENCE);
+        }
+
+        if (JUBI_ATOMIC_LOAD(&WORLD -> _QueuedCount) > 0) Jubi__ApplyQueuedForces2D(WORLD);
+    }
+
+    static void Jubi__ApplyQueuedForces2D(JubiWorld2D *WORLD) {
+        while (JUBI_ATOMIC_EXCHANGE(&WORLD -> _QueueLock, 1L)) {}
+
+        for (long i=0; i < WORLD -> _QueuedCount; i++) {
+            int INDEX = WORLD -> _HandleToIndex[WORLD -> _QueuedForces[i].Handle];
+            if (INDEX < 0) continue;
+
+            Body2D *BODY = &WORLD -> Bodies[INDEX];
+            if (BODY -> Type != BODY_DYNAMIC) continue;
+
+            BODY -> AccumulatedForce.x += WORLD -> _QueuedForces[i].Force.x;
+            BODY -> AccumulatedForce.y += WORLD -> _QueuedForces[i].Force.y;
+
+            Jubi__RecordBody2D(BODY, RECORD_FORCE, WORLD -> _QueuedForces[i].Force);
+        }
+
+        JUBI_ATOMIC_EXCHANGE(&WORLD -> _QueuedCount, 0L);
+        JUBI_ATOMIC_EXCHANGE(&WORLD -> _QueueLock, 0L);
+    }
+
+    static void Jubi__FreeAsync2D(JubiWorld2D *WORLD) {
+        Jubi__FinishAsync2D(WORLD);
+
+        #ifdef JUBI_ENABLE_THREADS
+            Jubi__AsyncWorker2D *WORKER = (Jubi__AsyncWorker2D *)WORLD -> _AsyncWorker;
+            if (WORKER == NULL) return;
+
+            JUBI__POOL_LOCK(WORKER);
+            WORKER -> Shutdown = 1;
+            JUBI__POOL_WAKE_ALL(WORKER, Wake);
+            JUBI__POOL_UNLOCK(WORKER);
+
+            #if defined(_WIN32)
+                WaitForSingleObject(WORKER -> Thread, INFINITE);
+                CloseHandle(WORKER -> Thread);
+            #else
+                pthread_join(WORKER -> Thread, NULL);
+
+                pthread_cond_destroy(&WORKER -> Done);
+                pthread_cond_destroy(&WORKER -> Wake);
+                pthread_mutex_destroy(&WORKER -> Lock);
+            #endif
+
+            JUBI_FREE(WORKER);
+        #endif
+
+        WORLD -> _AsyncWorker = NULL;
+    }
+
+    // Networking
+
+    typedef struct {
+        JUBI_UINT8 *DATA;
+        int CAPACITY;
+        int SIZE; // Bytes written, keeps counting past CAPACITY so overflow can be reported
+        JUBI_UINT64 BUFFER; // Bits not written out yet, lowest first
+        int BITS;
+    } Jubi__BitWriter;
+
+    typedef struct {
+        const JUBI_UINT8 *DATA;
+        int SIZE;
+        int POSITION;
+        JUBI_UINT64 BUFFER;
+        int BITS;
+        int OVERRUN; // Read past the end of DATA
+    } Jubi__BitReader;
+
+    // COUNT is at most 32, VALUE must fit in it
+    static void Jubi__WriteBits(Jubi__BitWriter *WRITER, JUBI_UINT32 VALUE, int COUNT) {
+        WRITER -> BUFFER |= (JUBI_UINT64)VALUE << WRITER -> BITS;
+        WRITER -> BITS += COUNT;
+
+        while (WRITER -> BITS >= 8) {
+            if (WRITER -> SIZE < WRITER -> CAPACITY) WRITER -> DATA[WRITER -> SIZE] = (JUBI_UINT8)WRITER -> BUFFER;
+
+            WRITER -> SIZE++;
+            WRITER -> BUFFER >>= 8;
+            WRITER -> BITS -= 8;
+        }
+    }
+
+    // Exp-Golomb, small values take few bits (0 is 1 bit, 1-2 are 3 bits, 3-6 are 5 bits, ...)
+    static void Jubi__WriteVarBits(Jubi__BitWriter *WRITER, JUBI_UINT32 VALUE) {
+        JUBI_UINT64 CODE = (JUBI_UINT64)VALUE + 1;
+
+        int LENGTH = 0;
+        while ((CODE >> LENGTH) > 1) LENGTH++;
+
+        Jubi__WriteBits(WRITER, 0, LENGTH);
+        Jubi__WriteBits(WRITER, 1, 1);
+
+        if (LENGTH > 0) Jubi__WriteBits(WRITER, (JUBI_UINT32)(CODE & ((1ull << LENGTH) - 1)), LENGTH);
+    }
+
+    static JUBI_UINT32 Jubi__ReadBits(Jubi__BitReader *READER, int COUNT) {
+        while (READER -> BITS < COUNT) {
+            JUBI_UINT64 BYTE = 0;
+
+            if (READER -> POSITION < READER -> SIZE) BYTE = READER -> DATA[READER -> POSITION];
+            else READER -> OVERRUN = 1;
+
+            READER -> POSITION++;
+            READER -> BUFFER |= BYTE << READER -> BITS;
+            READER -> BITS += 8;
+        }
+
+        JUBI_UINT32 VALUE = (JUBI_UINT32)(READER -> BUFFER & ((1ull << COUNT) - 1));
+
+        READER -> BUFFER >>= COUNT;
+        READER -> BITS -= COUNT;
+
+        return VALUE;
+    }
+
+    static JUBI_UINT32 Jubi__ReadVarBits(Jubi__BitReader *READER) {
+        int LENGTH = 0;
+
+        while (Jubi__ReadBits(READER, 1) == 0) {
+            if (++LENGTH > 32 || READER -> OVERRUN) {
+                READER -> OVERRUN = 1;
+
+                return 0;
+            }
+        }
+
+        JUBI_UINT64 CODE = (1ull << LENGTH) | (LENGTH > 0 ? Jubi__ReadBits(READER, LENGTH) : 0);
+
+        return (JUBI_UINT32)(CODE - 1);
+    }
+
+    // Deltas wrap around in unsigned math & are zigzagged so small negative deltas stay small too
+    static JUBI_UINT32 Jubi__ZigZag(JUBI_UINT32 DELTA) {
+        return (DELTA << 1) ^ (JUBI_UINT32)-(JUBI_INT32)(DELTA >> 31);
+    }
+
+    static JUBI_UINT32 Jubi__UnZigZag(JUBI_UINT32 VALUE) {
+        return (VALUE >> 1) ^ (JUBI_UINT32)-(JUBI_INT32)(VALUE & 1);
+    }
+
+    static JUBI_INT32 Jubi__Quantize(float VALUE, float INV_PRECISION) {
+        float Q = VALUE * INV_PRECISION;
+
+        // Also catches NaN
+        if (!(Q > -2.0e9f)) Q = -2.0e9f;
+        if (Q > 2.0e9f) Q = 2.0e9f;
+
+        return (JUBI_INT32)(Q < 0.0f ? Q - 0.5f : Q + 0.5f);
+    }
+
+    // Quantizes every body into CURRENT (keep it, once the client acknowledges this tick it's the next BASELINE) & writes only what changed since BASELINE into OUT. A NULL BASELINE sends every body. Returns the bytes written, or -1 (& no usable output) if OUT is too small.
+    int Jubi_EncodeSnapshot2D(JubiWorld2D *WORLD, const JubiNetFormat2D *FORMAT, const JubiSnapshot2D *BASELINE, JubiSnapshot2D *CURRENT, JUBI_UINT8 *OUT, int CAPACITY) {
+        Jubi__IncrementErrorTick();
+
+        if (Jubi_IsWorldValid(WORLD) != 1) {
+            Jubi__SetError(Jubi_GetWorldError(Jubi_IsWorldValid(WORLD)), __func__);
+
+            return -1;
+        } else if (FORMAT == NULL || CURRENT == NULL || (OUT == NULL && CAPACITY > 0)) {
+            Jubi__SetError(JUBI_ERROR_NULL_VALUE, __func__);
+
+            return -1;
+        } else if (FORMAT -> PositionPrecision <= 0.0f || FORMAT -> VelocityPrecision <= 0.0f || CURRENT == BASELINE) {
+            Jubi__SetError(JUBI_ERROR_INVALID_VALUE, __func__);
+
+            return -1;
+        }
+
+        float INV_POSITION = 1.0f / FORMAT -> PositionPrecision;
+        float INV_VELOCITY = 1.0f / FORMAT -> VelocityPrecision;
+
+        for (int h=0; h < JUBI_MAX_BODIES; h++)
+            CURRENT -> Present[h] = 0;
+
+        CURRENT -> Tick = (JUBI_UINT32)WORLD -> StepCount;
+
+        for (int i=0; i < WORLD -> BodyCount; i++) {
+            const Body2D *BODY = &WORLD -> Bodies[i];
+            JubiNetBody2D *STATE = &CURRENT -> Bodies[BODY -> Handle];
+
+            STATE -> X = Jubi__Quantize(BODY -> Position.x, INV_POSITION);
+            STATE -> Y = Jubi__Quantize(BODY -> Position.y, INV_POSITION);
+            STATE -> VX = Jubi__Quantize(BODY -> Velocity.x, INV_VELOCITY);
+            STATE -> VY = Jubi__Quantize(BODY -> Velocity.y, INV_VELOCITY);
+
+            CURRENT -> Present[BODY -> Handle] = 1;
+        }
+
+        // 1 = changed or new, 2 = removed. Resting bodies (including frozen & waiting ones) quantize to what the client already has & cost nothing.
+        JUBI_UINT8 CHANGE[JUBI_MAX_BODIES];
+        int CHANGES = 0;
+
+        for (int h=0; h < JUBI_MAX_BODIES; h++) {
+            int WAS = BASELINE && BASELINE -> Present[h];
+
+            CHANGE[h] = 0;
+
+            if (CURRENT -> Present[h] && !WAS) {
+                CHANGE[h] = 1;
+            } else if (CURRENT -> Present[h]) {
+                const JubiNetBody2D *NOW = &CURRENT -> Bodies[h];
+                const JubiNetBody2D *OLD = &BASELINE -> Bodies[h];
+
+                if (NOW -> X != OLD -> X || NOW -> Y != OLD -> Y || NOW -> VX != OLD -> VX || NOW -> VY != OLD -> VY) CHANGE[h] = 1;
+            } else if (WAS) {
+                CHANGE[h] = 2;
+            }
+
+            if (CHANGE[h]) CHANGES++;
+        }
+
+        Jubi__BitWriter WRITER = {OUT, CAPACITY, 0, 0, 0};
+
+        Jubi__WriteBits(&WRITER, CURRENT -> Tick, 32);
+        Jubi__WriteBits(&WRITER, BASELINE ? 1 : 0, 1);
+        if (BASELINE) Jubi__WriteBits(&WRITER, BASELINE -> Tick, 32);
+
+        Jubi__WriteVarBits(&WRITER, (JUBI_UINT32)CHANGES);
+
+        int PREVIOUS = -1;
+
+        for (int h=0; h < JUBI_MAX_BODIES; h++) {
+            if (!CHANGE[h]) continue;
+
+            Jubi__WriteVarBits(&WRITER, (JUBI_UINT32)(h - PREVIOUS - 1));
+            Jubi__WriteBits(&WRITER, CHANGE[h] == 2, 1);
+
+            PREVIOUS = h;
+
+            if (CHANGE[h] == 2) continue;
+
+            const JubiNetBody2D *NOW = &CURRENT -> Bodies[h];
+            JubiNetBody2D OLD = {0, 0, 0, 0};
+
+            if (BASELINE && BASELINE -> Present[h]) OLD = BASELINE -> Bodies[h];
+
+            Jubi__WriteVarBits(&WRITER, Jubi__ZigZag((JUBI_UINT32)NOW -> X - (JUBI_UINT32)OLD.X));
+            Jubi__WriteVarBits(&WRITER, Jubi__ZigZag((JUBI_UINT32)NOW -> Y - (JUBI_UINT32)OLD.Y));
+            Jubi__WriteVarBits(&WRITER, Jubi__ZigZag((JUBI_UINT32)NOW -> VX - (JUBI_UINT32)OLD.VX));
+            Jubi__WriteVarBits(&WRITER, Jubi__ZigZag((JUBI_UINT32)NOW -> VY - (JUBI_UINT32)OLD.VY));
+        }
+
+        // Pad out the last byte
+        if (WRITER.BITS > 0) Jubi__WriteBits(&WRITER, 0, 8 - WRITER.BITS);
+
+        if (WRITER.SIZE > CAPACITY) {
+            Jubi__SetError(JUBI_ERROR_INVALID_VALUE, __func__);
+
+            return -1;
+        }
+
+        return WRITER.SIZE;
+    }
+
+    // Rebuilds the sender's CURRENT snapshot from DATA. BASELINE has to be the snapshot the sender encoded against (checked by tick). Returns 1, or -1 if DATA is cut short or the baseline doesn't match.
+    int Jubi_DecodeSnapshot2D(const JUBI_UINT8 *DATA, int SIZE, const JubiSnapshot2D *BASELINE, JubiSnapshot2D *OUT) {
+        Jubi__IncrementErrorTick();
+
+        if (DATA == NULL || OUT == NULL) {
+            Jubi__SetError(JUBI_ERROR_NULL_VALUE, __func__);
+
+            return -1;
+        } else if (SIZE <= 0 || OUT == BASELINE) {
+            Jubi__SetError(JUBI_ERROR_INVALID_VALUE, __func__);
+
+            return -1;
+        }
+
+        Jubi__BitReader READER = {DATA, SIZE, 0, 0, 0, 0};
+
+        JUBI_UINT32 TICK = Jubi__ReadBits(&READER, 32);
+        int HAS_BASELINE = (int)Jubi__ReadBits(&READER, 1);
+
+        if (HAS_BASELINE) {
+            JUBI_UINT32 BASELINE_TICK = Jubi__ReadBits(&READER, 32);
+
+            if (BASELINE == NULL || BASELINE -> Tick != BASELINE_TICK) {
+                Jubi__SetError(JUBI_ERROR_INVALID_VALUE, __func__);
+
+                return -1;
+            }
+        }
+
+        for (int h=0; h < JUBI_MAX_BODIES; h++) {
+            OUT -> Present[h] = HAS_BASELINE ? BASELINE -> Present[h] : 0;
+
+            if (OUT -> Present[h]) OUT -> Bodies[h] = BASELINE -> Bodies[h];
+        }
+
+        OUT -> Tick = TICK;
+
+        JUBI_UINT32 CHANGES = Jubi__ReadVarBits(&READER);
+        int HANDLE = -1;
+
+        for (JUBI_UINT32 i=0; i < CHANGES && !READER.OVERRUN; i++) {
+            HANDLE += (int)Jubi__ReadVarBits(&READER) + 1;
+
+            if (HANDLE < 0 || HANDLE >= JUBI_MAX_BODIES) {
+                READER.OVERRUN = 1;
+
+                break;
+            }
+
+            if (Jubi__ReadBits(&READER, 1)) {
+                OUT -> Present[HANDLE] = 0;
+
+                continue;
+            }
+
+            JubiNetBody2D OLD = {0, 0, 0, 0};
+            if (OUT -> Present[HANDLE]) OLD = OUT -> Bodies[HANDLE];
+
+            JubiNetBody2D *STATE = &OUT -> Bodies[HANDLE];
+
+            STATE -> X = (JUBI_INT32)((JUBI_UINT32)OLD.X + Jubi__UnZigZag(Jubi__ReadVarBits(&READER)));
+            STATE -> Y = (JUBI_INT32)((JUBI_UINT32)OLD.Y + Jubi__UnZigZag(Jubi__ReadVarBits(&READER)));
+            STATE -> VX = (JUBI_INT32)((JUBI_UINT32)OLD.VX + Jubi__UnZigZag(Jubi__ReadVarBits(&READER)));
+            STATE -> VY = (JUBI_INT32)((JUBI_UINT32)OLD.VY + Jubi__UnZigZag(Jubi__ReadVarBits(&READER)));
+
+            OUT -> Present[HANDLE] = 1;
+        }
+
+        if (READER.OVERRUN) {
+            Jubi__SetError(JUBI_ERROR_INVALID_VALUE, __func__);
+
+            return -1;
+        }
+
+        return 1;
+    }
+
+    // Moves the world's bodies to a decoded snapshot, matched by handle. Bodies the world doesn't have are left to the caller to create. Returns how many bodies were updated.
+    int Jubi_ApplySnapshot2D(JubiWorld2D *WORLD, const JubiNetFormat2D *FORMAT, const JubiSnapshot2D *SNAPSHOT) {
+        Jubi__IncrementErrorTick();
+
+        if (Jubi_IsWorldValid(WORLD) != 1) {
+            Jubi__SetError(Jubi_GetWorldError(Jubi_IsWorldValid(WORLD)), __func__);
+
+            return -1;
+        } else if (FORMAT == NULL || SNAPSHOT == NULL) {
+            Jubi__SetError(JUBI_ERROR_NULL_VALUE, __func__);
+
+            return -1;
+        }
+
+        int APPLIED = 0;
+
+        for (int i=0; i < WORLD -> BodyCount; i++) {
+            Body2D *BODY = &WORLD -> Bodies[i];
+            if (!SNAPSHOT -> Present[BODY -> Handle]) continue;
+
+            const JubiNetBody2D *STATE = &SNAPSHOT -> Bodies[BODY -> Handle];
+
+            BODY -> Position = (Vector2){(float)STATE -> X * FORMAT -> PositionPrecision, (float)STATE -> Y * FORMAT -> PositionPrecision};
+            BODY -> Velocity = (Vector2){(float)STATE -> VX * FORMAT -> VelocityPrecision, (float)STATE -> VY * FORMAT -> VelocityPrecision};
+
+            Jubi__UpdateBounds2D(BODY);
+
+            APPLIED++;
+        }
+
+        WORLD -> _BroadphaseDirty = 1;
+
+        return APPLIED;
+    }
+
+    // Flight Recorder
+
+    typedef struct {
+        JUBI_UINT32 Type; // RecordType2D
+        JUBI_INT32 Handle; // Step features for RECORD_STEP
+        Vector2 Value; // Delta time in x for RECORD_STEP
+    } Jubi__RecordEvent2D;
+
+    // Events cost 16 bytes (RECORD_ADD also carries the body). Every KEYFRAME_INTERVAL steps the bodies are copied into one of JUBI_RECORDER_KEYFRAMES keyframes, & keyframes whose events have been overwritten are dropped, so the window that can be replayed is up to BYTES of events back from the newest step.
+    int Jubi_EnableRecorder2D(JubiWorld2D *WORLD, size_t BYTES, int KEYFRAME_INTERVAL) {
+        Jubi__IncrementErrorTick();
+
+        if (Jubi_IsWorldValid(WORLD) != 1) {
+            Jubi__SetError(Jubi_GetWorldError(Jubi_IsWorldValid(WORLD)), __func__);
+
+            return -1;
+        } else if (BYTES < sizeof(Jubi__RecordEvent2D) + sizeof(Body2D) || KEYFRAME_INTERVAL <= 0) {
+            Jubi__SetError(JUBI_ERROR_INVALID_VALUE, __func__);
+
+            return -1;
+        }
+
+        Jubi_DisableRecorder2D(WORLD);
+
+        JubiRecorder2D *RECORDER = (JubiRecorder2D *)JUBI_MALLOC(sizeof(JubiRecorder2D));
+        JUBI_UINT8 *EVENTS = (JUBI_UINT8 *)JUBI_MALLOC(BYTES);
+        Body2D *BODIES = (Body2D *)JUBI_MALLOC(sizeof(Body2D) * JUBI_MAX_BODIES * JUBI_RECORDER_KEYFRAMES);
+
+        if (RECORDER == NULL || EVENTS == NULL || BODIES == NULL) {
+            JUBI_FREE(RECORDER);
+            JUBI_FREE(EVENTS);
+            JUBI_FREE(BODIES);
+
+            Jubi__SetError(JUBI_ERROR_NULL_VALUE, __func__);
+
+            return -1;
+        }
+
+        *RECORDER = (JubiRecorder2D){0};
+
+        RECORDER -> Events = EVENTS;
+        RECORDER -> Capacity = BYTES;
+        RECORDER -> KeyframeInterval = KEYFRAME_INTERVAL;
+
+        for (int k=0; k < JUBI_RECORDER_KEYFRAMES; k++)
+            RECORDER -> Keyframes[k].Bodies = BODIES + (size_t)k * JUBI_MAX_BODIES;
+
+        WORLD -> Recorder = RECORDER;
+
+        return 1;
+    }
+
+    void Jubi_DisableRecorder2D(JubiWorld2D *WORLD) {
+        if (WORLD == NULL || WORLD -> Recorder == NULL) return;
+
+        JUBI_FREE(WORLD -> Recorder -> Events);
+        JUBI_FREE(WORLD -> Recorder -> Keyframes[0].Bodies);
+        JUBI_FREE(WORLD -> Recorder);
+
+        WORLD -> Recorder = NULL;
+    }
+
+    // Rebuilds RECORDED's window in TARGET, from its oldest keyframe up to step UNTIL (0 for everything recorded). TARGET has to be set up like RECORDED (shapes, joints, force fields, tilemaps), since only bodies & what's done to them are recorded. Returns the steps replayed.
+    int Jubi_ReplayRecording2D(JubiWorld2D *RECORDED, JubiWorld2D *TARGET, JUBI_UINT64 UNTIL) {
+        Jubi__IncrementErrorTick();
+
+        if (Jubi_IsWorldValid(RECORDED) != 1 || Jubi_IsWorldValid(TARGET) != 1) {
+            Jubi__SetError(Jubi_GetWorldError(Jubi_IsWorldValid(Jubi_IsWorldValid(RECORDED) != 1 ? RECORDED : TARGET)), __func__);
+
+            return -1;
+        } else if (RECORDED == TARGET || RECORDED -> Recorder == NULL) {
+            Jubi__SetError(JUBI_ERROR_INVALID_VALUE, __func__);
+
+            return -1;
+        }
+
+        JubiRecorder2D *RECORDER = RECORDED -> Recorder;
+        const JubiKeyframe2D *KEYFRAME = NULL;
+
+        for (int k=0; k < JUBI_RECORDER_KEYFRAMES; k++) {
+            const JubiKeyframe2D *CANDIDATE = &RECORDER -> Keyframes[k];
+
+            if (CANDIDATE -> Valid && (KEYFRAME == NULL || CANDIDATE -> Step < KEYFRAME -> Step)) KEYFRAME = CANDIDATE;
+        }
+
+        if (KEYFRAME == NULL) {
+            Jubi__SetError(JUBI_ERROR_INVALID_VALUE, __func__);
+
+            return -1;
+        }
+
+        Jubi__FinishAsync2D(TARGET);
+
+        TARGET -> BodyCount = KEYFRAME -> BodyCount;
+
+        for (int i=0; i < KEYFRAME -> BodyCount; i++) {
+            TARGET -> Bodies[i] = KEYFRAME -> Bodies[i];
+            TARGET -> Bodies[i].WORLD = TARGET;
+        }
+
+        for (int i=0; i < JUBI_MAX_BODIES; i++) {
+            TARGET -> _HandleToIndex[i] = KEYFRAME -> HandleToIndex[i];
+            TARGET -> _FreeHandles[i] = KEYFRAME -> FreeHandles[i];
+            TARGET -> _SortedBodies[i] = KEYFRAME -> SortedBodies[i];
+        }
+
+        TARGET -> _FreeHandleCount = KEYFRAME -> FreeHandleCount;
+        TARGET -> _SortedCount = KEYFRAME -> SortedCount;
+        TARGET -> _BroadphaseDirty = KEYFRAME -> BroadphaseDirty;
+        TARGET -> _MaxWidthX = KEYFRAME -> MaxWidthX;
+        TARGET -> _JointsDirty = 1;
+        TARGET -> StepCount = KEYFRAME -> Step;
+
+        int STEPS = 0;
+
+        for (JUBI_UINT64 AT = KEYFRAME -> Start; AT < RECORDER -> Head;) {
+            Jubi__RecordEvent2D EVENT;
+
+            Jubi__ReadRecord2D(RECORDER, AT, &EVENT, sizeof(EVENT));
+            AT += sizeof(EVENT);
+
+            if (EVENT.Type == RECORD_STEP) {
+                if (UNTIL > 0 && TARGET -> StepCount >= UNTIL) break;
+
+                Jubi__StepWorld2D(TARGET, EVENT.Value.x, (JUBI_UINT32)EVENT.Handle);
+                STEPS++;
+            } else if (EVENT.Type == RECORD_FORCE) {
+                Body2D *BODY = Jubi_GetBodyFromHandle2D(TARGET, EVENT.Handle);
+                if (BODY) JBody2D_ApplyForce(BODY, EVENT.Value);
+            } else if (EVENT.Type == RECORD_IMPULSE) {
+                Body2D *BODY = Jubi_GetBodyFromHandle2D(TARGET, EVENT.Handle);
+                if (BODY) JBody2D_ApplyImpulse(BODY, EVENT.Value);
+            } else if (EVENT.Type == RECORD_ADD) {
+                Body2D BODY;
+
+                Jubi__ReadRecord2D(RECORDER, AT, &BODY, sizeof(BODY));
+                AT += sizeof(BODY);
+
+                // Handles come off the restored free list in the same order they did when recording
+                Jubi_AddBodyToWorld(TARGET, &BODY);
+            } else if (EVENT.Type == RECORD_REMOVE) {
+                JBody2D_DestroyBatch(TARGET, &EVENT.Handle, 1);
+            }
+        }
+
+        return STEPS;
+    }
+
+    // Copies SIZE bytes out of the ring starting at stream position AT
+    static void Jubi__ReadRecord2D(const JubiRecorder2D *RECORDER, JUBI_UINT64 AT, void *OUT, size_t SIZE) {
+        size_t OFFSET = (size_t)(AT % RECORDER -> Capacity);
+        size_t FIRST = RECORDER -> Capacity - OFFSET < SIZE ? RECORDER -> Capacity - OFFSET : SIZE;
+
+        memcpy(OUT, RECORDER -> Events + OFFSET, FIRST);
+        memcpy((JUBI_UINT8 *)OUT + FIRST, RECORDER -> Events, SIZE - FIRST);
+    }
+
+    static void Jubi__WriteRecord2D(JubiRecorder2D *RECORDER, const void *DATA, size_t SIZE) {
+        size_t OFFSET = (size_t)(RECORDER -> Head % RECORDER -> Capacity);
+        size_t FIRST = RECORDER -> Capacity - OFFSET < SIZE ? RECORDER -> Capacity - OFFSET : SIZE;
+
+        memcpy(RECORDER -> Events + OFFSET, DATA, FIRST);
+        memcpy(RECORDER -> Events, (const JUBI_UINT8 *)DATA + FIRST, SIZE - FIRST);
+
+        RECORDER -> Head += SIZE;
+
+        // Keyframes need every event after them
+        if (RECORDER -> Head - RECORDER -> _OldestStart > RECORDER -> Capacity) {
+            JUBI_UINT64 OLDEST = RECORDER -> Head;
+
+            for (int k=0; k < JUBI_RECORDER_KEYFRAMES; k++) {
+                JubiKeyframe2D *KEYFRAME = &RECORDER -> Keyframes[k];
+                if (!KEYFRAME -> Valid) continue;
+
+                if (RECORDER -> Head - KEYFRAME -> Start > RECORDER -> Capacity) KEYFRAME -> Valid = 0;
+                else if (KEYFRAME -> Start < OLDEST) OLDEST = KEYFRAME -> Start;
+            }
+
+            RECORDER -> _OldestStart = OLDEST;
+        }
+    }
+
+    // Bodies passed in have to be the world's own (not copies) to be recorded
+    static void Jubi__RecordBody2D(const Body2D *BODY, RecordType2D TYPE, Vector2 VALUE) {
+        JubiWorld2D *WORLD = BODY -> WORLD;
+
+        if (WORLD == NULL || WORLD -> Recorder == NULL || WORLD -> Recorder -> _Stepping) return;
+        if (Jubi_GetBodyFromHandle2D(WORLD, BODY -> Handle) != BODY) return;
+
+        Jubi__RecordEvent2D EVENT = {(JUBI_UINT32)TYPE, BODY -> Handle, VALUE};
+
+        Jubi__WriteRecord2D(WORLD -> Recorder, &EVENT, sizeof(EVENT));
+
+        if (TYPE == RECORD_ADD) Jubi__WriteRecord2D(WORLD -> Recorder, BODY, sizeof(Body2D));
+    }
+
+    static void Jubi__RecordStep2D(JubiWorld2D *WORLD, float DeltaTime, JUBI_UINT32 FEATURES) {
+        JubiRecorder2D *RECORDER = WORLD -> Recorder;
+
+        int ANY = 0;
+
+        for (int k=0; k < JUBI_RECORDER_KEYFRAMES; k++)
+            ANY |= RECORDER -> Keyframes[k].Valid;
+
+        if (!ANY || WORLD -> StepCount % (JUBI_UINT64)RECORDER -> KeyframeInterval == 0) {
+            // Replaces the oldest, the slots are used round robin
+            JubiKeyframe2D *KEYFRAME = &RECORDER -> Keyframes[RECORDER -> _NextKeyframe];
+            RECORDER -> _NextKeyframe = (RECORDER -> _NextKeyframe + 1) % JUBI_RECORDER_KEYFRAMES;
+
+            KEYFRAME -> Step = WORLD -> StepCount;
+            KEYFRAME -> Start = RECORDER -> Head;
+            KEYFRAME -> BodyCount = WORLD -> BodyCount;
+
+            memcpy(KEYFRAME -> Bodies, WORLD -> Bodies, sizeof(Body2D) * (size_t)WORLD -> BodyCount);
+            memcpy(KEYFRAME -> HandleToIndex, WORLD -> _HandleToIndex, sizeof(KEYFRAME -> HandleToIndex));
+            memcpy(KEYFRAME -> FreeHandles, WORLD -> _FreeHandles, sizeof(KEYFRAME -> FreeHandles));
+            memcpy(KEYFRAME -> SortedBodies, WORLD -> _SortedBodies, sizeof(KEYFRAME -> SortedBodies));
+
+            KEYFRAME -> FreeHandleCount = WORLD -> _FreeHandleCount;
+            KEYFRAME -> SortedCount = WORLD -> _SortedCount;
+            KEYFRAME -> BroadphaseDirty = WORLD -> _BroadphaseDirty;
+            KEYFRAME -> MaxWidthX = WORLD -> _MaxWidthX;
+            KEYFRAME -> Valid = 1;
+
+            RECORDER -> _OldestStart = KEYFRAME -> Start;
+
+            for (int k=0; k < JUBI_RECORDER_KEYFRAMES; k++) {
+                if (RECORDER -> Keyframes[k].Valid && RECORDER -> Keyframes[k].Start < RECORDER -> _OldestStart) RECORDER -> _OldestStart = RECORDER -> Keyframes[k].Start;
+            }
+        }
+
+        Jubi__RecordEvent2D EVENT = {RECORD_STEP, (JUBI_INT32)FEATURES, {DeltaTime, 0.0f}};
+
+        Jubi__WriteRecord2D(RECORDER, &EVENT, sizeof(EVENT));
+    }
+
+    // Sensors
+
+    // The bounds already overlap, circles get one more cheap check so round aggro radii don't report their corners
+    static int Jubi__SensorOverlaps2D(const Body2D *A, const Body2D *B) {
+        if (A -> Shape == SHAPE_CIRCLE && B -> Shape == SHAPE_CIRCLE) {
+            float DX = B -> Position.x - A -> Position.x;
+            float DY = B -> Position.y - A -> Position.y;
+            float RADII = (A -> _Size.x + B -> _Size.x) * .5f;
+
+            return DX * DX + DY * DY < RADII * RADII;
+        }
+
+        if (A -> Shape == SHAPE_CIRCLE) return JCollision_AABBvsCircle(B -> Bounds, (Circle2D){A -> Position, A -> _Size.x * .5f});
+        if (B -> Shape == SHAPE_CIRCLE) return JCollision_AABBvsCircle(A -> Bounds, (Circle2D){B -> Position, B -> _Size.x * .5f});
+
+        return 1;
+    }
+
+    static void Jubi__AddSensorOverlap2D(JubiWorld2D *WORLD, const Body2D *A, const Body2D *B) {
+        if (WORLD -> SensorOverlapCount == WORLD -> _SensorOverlapCapacity) {
+            int CAPACITY = WORLD -> _SensorOverlapCapacity > 0 ? WORLD -> _SensorOverlapCapacity * 2 : 64;
+            JubiSensorOverlap2D *GROWN = (JubiSensorOverlap2D *)Jubi__ArenaAlloc(&WORLD -> Scratch, sizeof(JubiSensorOverlap2D) * CAPACITY);
+
+            // Out of memory, the overlaps already found are all that's reported
+            if (GROWN == NULL) return;
+
+            for (int i=0; i < WORLD -> SensorOverlapCount; i++) GROWN[i] = WORLD -> SensorOverlaps[i];
+
+            WORLD -> SensorOverlaps = GROWN;
+            WORLD -> _SensorOverlapCapacity = CAPACITY;
+        }
+
+        const Body2D *SENSOR = (A -> Flags & JUBI_BODY_SENSOR) ? A : B;
+        const Body2D *OTHER = SENSOR == A ? B : A;
+
+        WORLD -> SensorOverlaps[WORLD -> SensorOverlapCount].Sensor = SENSOR -> Handle;
+        WORLD -> SensorOverlaps[WORLD -> SensorOverlapCount].Other = OTHER -> Handle;
+        WORLD -> SensorOverlapCount++;
+    }
+
+    // Spatial Reordering
+
+    // Bodies that are close in the world end up close in Bodies, so the pair sweep & resolution walk memory in order instead of jumping around it. Handles stay valid, Body2D pointers & indices don't.
+    int Jubi_ReorderBodies2D(JubiWorld2D *WORLD) {
+        Jubi__IncrementErrorTick();
+
+        if (Jubi_IsWorldValid(WORLD) != 1) {
+            Jubi__SetError(Jubi_GetWorldError(Jubi_IsWorldValid(WORLD)), __func__);
+
+            return -1;
+        }
+
+        Jubi__FinishAsync2D(WORLD);
+        Jubi__ReorderBodies2D(WORLD);
+
+        return 1;
+    }
+
+    // Interleaves the low 16 bits of X & Y, X in the even bits
+    static JUBI_UINT32 Jubi__Morton2D(JUBI_UINT32 X, JUBI_UINT32 Y) {
+        X &= 0xFFFF;
+        X = (X | (X << 8)) & 0x00FF00FF;
+        X = (X | (X << 4)) & 0x0F0F0F0F;
+        X = (X | (X << 2)) & 0x33333333;
+        X = (X | (X << 1)) & 0x55555555;
+
+        Y &= 0xFFFF;
+        Y = (Y | (Y << 8)) & 0x00FF00FF;
+        Y = (Y | (Y << 4)) & 0x0F0F0F0F;
+        Y = (Y | (Y << 2)) & 0x33333333;
+        Y = (Y | (Y << 1)) & 0x55555555;
+
+        return X | (Y << 1);
+    }
+
+    // Positions are quantized to 16 bits over the bounds of every body, then sorted by an LSD radix sort (4 passes of 8 bits, stable so ties keep their order)
+    static void Jubi__ReorderBodies2D(JubiWorld2D *WORLD) {
+        int COUNT = WORLD -> BodyCount;
+        if (COUNT < 2) return;
+
+        float MIN_X = WORLD -> Bodies[0].Position.x, MAX_X = MIN_X;
+        float MIN_Y = WORLD -> Bodies[0].Position.y, MAX_Y = MIN_Y;
+
+        for (int i=1; i < COUNT; i++) {
+            Vector2 POSITION = WORLD -> Bodies[i].Position;
+
+            if (POSITION.x < MIN_X) MIN_X = POSITION.x;
+            if (POSITION.x > MAX_X) MAX_X = POSITION.x;
+            if (POSITION.y < MIN_Y) MIN_Y = POSITION.y;
+            if (POSITION.y > MAX_Y) MAX_Y = POSITION.y;
+        }
+
+        float SCALE_X = MAX_X > MIN_X ? 65535.0f / (MAX_X - MIN_X) : 0.0f;
+        float SCALE_Y = MAX_Y > MIN_Y ? 65535.0f / (MAX_Y - MIN_Y) : 0.0f;
+
+        JUBI_UINT32 *KEYS = (JUBI_UINT32 *)Jubi__ArenaAlloc(&WORLD -> Scratch, sizeof(JUBI_UINT32) * COUNT * 2);
+        int *ORDER = (int *)Jubi__ArenaAlloc(&WORLD -> Scratch, sizeof(int) * COUNT * 2);
+
+        // Out of memory, the order stays as it is
+        if (KEYS == NULL || ORDER == NULL) return;
+
+        JUBI_UINT32 *KEYS_OUT = KEYS + COUNT;
+        int *ORDER_OUT = ORDER + COUNT;
+
+        for (int i=0; i < COUNT; i++) {
+            float QX = (WORLD -> Bodies[i].Position.x - MIN_X) * SCALE_X;
+            float QY = (WORLD -> Bodies[i].Position.y - MIN_Y) * SCALE_Y;
+
+            // Written so NaN positions land at 0 too
+            QX = QX > 0.0f ? (QX < 65535.0f ? QX : 65535.0f) : 0.0f;
+            QY = QY > 0.0f ? (QY < 65535.0f ? QY : 65535.0f) : 0.0f;
+
+            KEYS[i] = Jubi__Morton2D((JUBI_UINT32)QX, (JUBI_UINT32)QY);
+            ORDER[i] = i;
+        }
+
+        for (int SHIFT=0; SHIFT < 32; SHIFT += 8) {
+            int OFFSETS[256] = {0};
+
+            for (int i=0; i < COUNT; i++) OFFSETS[(KEYS[i] >> SHIFT) & 0xFF]++;
+
+            // Every key has the same digit, the pass wouldn't move anything
+            if (OFFSETS[(KEYS[0] >> SHIFT) & 0xFF] == COUNT) continue;
+
+            for (int d=0, TOTAL=0; d < 256; d++) {
+                int DIGIT_COUNT = OFFSETS[d];
+
+                OFFSETS[d] = TOTAL;
+                TOTAL += DIGIT_COUNT;
+            }
+
+            for (int i=0; i < COUNT; i++) {
+                int AT = OFFSETS[(KEYS[i] >> SHIFT) & 0xFF]++;
+
+                KEYS_OUT[AT] = KEYS[i];
+                ORDER_OUT[AT] = ORDER[i];
+            }
+
+            JUBI_UINT32 *SWAP_KEYS = KEYS; KEYS = KEYS_OUT; KEYS_OUT = SWAP_KEYS;
+            int *SWAP_ORDER = ORDER; ORDER = ORDER_OUT; ORDER_OUT = SWAP_ORDER;
+        }
+
+        int MOVED = 0;
+
+        for (int i=0; i < COUNT && !MOVED; i++)
+            if (ORDER[i] != i) MOVED = 1;
+
+        if (!MOVED) return;
+
+        Body2D *OLD = (Body2D *)Jubi__ArenaAlloc(&WORLD -> Scratch, sizeof(Body2D) * COUNT);
+        if (OLD == NULL) return;
+
+        int *NEW_INDEX = ORDER_OUT; // The other half is free now
+
+        memcpy(OLD, WORLD -> Bodies, sizeof(Body2D) * COUNT);
+
+        for (int i=0; i < COUNT; i++) {
+            WORLD -> Bodies[i] = OLD[ORDER[i]];
+            WORLD -> Bodies[i].Index = i;
+
+            WORLD -> _HandleToIndex[WORLD -> Bodies[i].Handle] = i;
+            NEW_INDEX[ORDER[i]] = i;
+        }
+
+        // Keep the sweep order, so the broadphase's insertion sort still starts from nearly sorted
+        if (WORLD -> _SortedCount == COUNT) {
+            for (int i=0; i < COUNT; i++)
+                WORLD -> _SortedBodies[i] = NEW_INDEX[WORLD -> _SortedBodies[i]];
+        }
+    }
+
+    // Prediction
+
+    // Where bodies will be over the next STEPS steps of DeltaTime, integrated exactly like the world step does (gravity, drag & any force already applied this step) but without joints, force fields or other bodies. Kinematic bodies carry on at their set velocity. With COLLIDE, dynamic paths stop at the first static body they'd sweep into. Bodies that can't move get a path that stays put. Nothing in the world is changed.
+    int Jubi_PredictPaths2D(JubiWorld2D *WORLD, JubiPrediction2D *PREDICTIONS, int COUNT, float DeltaTime, int STEPS, int COLLIDE) {
+        Jubi__IncrementErrorTick();
+
+        if (Jubi_IsWorldValid(WORLD) != 1) {
+            Jubi__SetError(Jubi_GetWorldError(Jubi_IsWorldValid(WORLD)), __func__);
+
+            return -1;
+        }
+
+        // Handles & bodies are only settled once a running step is done
+        Jubi__FinishAsync2D(WORLD);
+
+        if ((PREDICTIONS == NULL && COUNT > 0) || COUNT < 0 || STEPS <= 0 || DeltaTime <= 0.0f) {
+            Jubi__SetError(JUBI_ERROR_INVALID_VALUE, __func__);
+
+            return -1;
+        }
+
+        for (int p=0; p < COUNT; p++) {
+            if (PREDICTIONS[p].Path == NULL) {
+                Jubi__SetError(JUBI_ERROR_NULL_VALUE, __func__);
+
+                return -1;
+            } else if (Jubi_GetBodyFromHandle2D(WORLD, PREDICTIONS[p].Handle) == NULL) {
+                Jubi__SetError(JUBI_ERROR_NULL_BODY, __func__);
+
+                return -1;
+            }
+        }
+
+        if (COUNT == 0) return 0;
+
+        // Everything below is handed back before returning, so repeated predictions between steps don't keep growing the arena
+        JubiArena MARK = WORLD -> Scratch;
+
+        // Every body is advanced a step at a time side by side, from plain arrays
+        float *X = (float *)Jubi__ArenaAlloc(&WORLD -> Scratch, sizeof(float) * COUNT * 8);
+
+        if (X == NULL) {
+            Jubi__RewindArena(&WORLD -> Scratch, MARK);
+            Jubi__SetError(JUBI_ERROR_WORLD_FULL, __func__);
+
+            return -1;
+        }
+
+        float *Y = X + COUNT, *VX = Y + COUNT, *VY = VX + COUNT, *AX = VY + COUNT, *AY = AX + COUNT, *FALL = AY + COUNT, *DRAG = FALL + COUNT;
+
+        for (int p=0; p < COUNT; p++) {
+            const Body2D *BODY = Jubi_GetBodyFromHandle2D(WORLD, PREDICTIONS[p].Handle);
+
+            X[p] = BODY -> Position.x;
+            Y[p] = BODY -> Position.y;
+
+            PREDICTIONS[p].HitStep = -1;
+
+            // Kinematic bodies ignore gravity, drag & forces
+            if (BODY -> Type == BODY_KINEMATIC && !(BODY -> Flags & JUBI_BODY_HELD)) {
+                VX[p] = BODY -> Velocity.x;
+                VY[p] = BODY -> Velocity.y;
+                AX[p] = AY[p] = FALL[p] = 0.0f;
+                DRAG[p] = 1.0f;
+
+                continue;
+            }
+
+            if (BODY -> Type != BODY_DYNAMIC || BODY -> InvMass <= 0.0f || (BODY -> Flags & JUBI_BODY_HELD)) {
+                VX[p] = VY[p] = AX[p] = AY[p] = FALL[p] = 0.0f;
+                DRAG[p] = 1.0f;
+
+                continue;
+            }
+
+            VX[p] = BODY -> Velocity.x;
+            VY[p] = BODY -> Velocity.y;
+            DRAG[p] = 1.0f - AIR_RESISTANCE;
+
+            // Forces already applied only last for the first step, same as the world step
+            AX[p] = BODY -> AccumulatedForce.x * BODY -> InvMass;
+            AY[p] = (BODY -> AccumulatedForce.y + BODY -> Mass * GRAVITY) * BODY -> InvMass;
+            FALL[p] = BODY -> Mass * GRAVITY * BODY -> InvMass;
+        }
+
+        for (int STEP=0; STEP < STEPS; STEP++) {
+            for (int p=0; p < COUNT; p++) {
+                VX[p] += AX[p] * DeltaTime;
+                VY[p] += AY[p] * DeltaTime;
+
+                VX[p] *= DRAG[p];
+                VY[p] *= DRAG[p];
+
+                X[p] += VX[p] * DeltaTime;
+                Y[p] += VY[p] * DeltaTime;
+
+                PREDICTIONS[p].Path[STEP] = (Vector2){X[p], Y[p]};
+            }
+
+            if (STEP > 0) continue;
+
+            for (int p=0; p < COUNT; p++) {
+                AX[p] = 0.0f;
+                AY[p] = FALL[p];
+            }
+        }
+
+        if (!COLLIDE) {
+            Jubi__RewindArena(&WORLD -> Scratch, MARK);
+
+            return COUNT;
+        }
+
+        Jubi__UpdateBroadphase2D(WORLD);
+
+        int *CANDIDATES = (int *)Jubi__ArenaAlloc(&WORLD -> Scratch, sizeof(int) * (WORLD -> BodyCount > 0 ? WORLD -> BodyCount : 1));
+
+        if (CANDIDATES == NULL) {
+            Jubi__RewindArena(&WORLD -> Scratch, MARK);
+            Jubi__SetError(JUBI_ERROR_WORLD_FULL, __func__);
+
+            return -1;
+        }
+
+        for (int p=0; p < COUNT; p++) {
+            const Body2D *BODY = Jubi_GetBodyFromHandle2D(WORLD, PREDICTIONS[p].Handle);
+            Vector2 *PATH = PREDICTIONS[p].Path;
+
+            // Only dynamic bodies are stopped by statics, kinematic ones move straight through
+            if (BODY -> Type != BODY_DYNAMIC) continue;
+
+            // Bounds relative to the position, moved along the path
+            Vector2 LOW = JVector2_Subtract(BODY -> Bounds.Min, BODY -> Position);
+            Vector2 HIGH = JVector2_Subtract(BODY -> Bounds.Max, BODY -> Position);
+
+            AABB SWEPT = BODY -> Bounds;
+
+            for (int STEP=0; STEP < STEPS; STEP++) {
+                if (PATH[STEP].x + LOW.x < SWEPT.Min.x) SWEPT.Min.x = PATH[STEP].x + LOW.x;
+                if (PATH[STEP].y + LOW.y < SWEPT.Min.y) SWEPT.Min.y = PATH[STEP].y + LOW.y;
+                if (PATH[STEP].x + HIGH.x > SWEPT.Max.x) SWEPT.Max.x = PATH[STEP].x + HIGH.x;
+                if (PATH[STEP].y + HIGH.y > SWEPT.Max.y) SWEPT.Max.y = PATH[STEP].y + HIGH.y;
+            }
+
+            // One query for the whole path, then each step only checks the statics it found
+            int FOUND = Jubi__QueryAABB2D(WORLD, SWEPT, CANDIDATES, WORLD -> BodyCount);
+            int STATICS = 0;
+
+            for (int i=0; i < FOUND; i++) {
+                const Body2D *OTHER = &WORLD -> Bodies[CANDIDATES[i]];
+
+                if (OTHER -> Type == BODY_STATIC && !(OTHER -> Flags & JUBI_BODY_SENSOR) && OTHER != BODY) CANDIDATES[STATICS++] = CANDIDATES[i];
+            }
+
+            if (STATICS == 0) continue;
+
+            Vector2 FROM = BODY -> Position;
+
+            for (int STEP=0; STEP < STEPS; STEP++) {
+                Vector2 DISPLACEMENT = JVector2_Subtract(PATH[STEP], FROM);
+                AABB START = {JVector2_Add(FROM, LOW), JVector2_Add(FROM, HIGH)};
+
+                // Around the whole step, most statics are nowhere near it
+                AABB STEP_BOUNDS = START;
+
+                if (DISPLACEMENT.x < 0.0f) STEP_BOUNDS.Min.x += DISPLACEMENT.x; else STEP_BOUNDS.Max.x += DISPLACEMENT.x;
+                if (DISPLACEMENT.y < 0.0f) STEP_BOUNDS.Min.y += DISPLACEMENT.y; else STEP_BOUNDS.Max.y += DISPLACEMENT.y;
+
+                float FIRST_TOI = 2.0f;
+
+                for (int i=0; i < STATICS; i++) {
+                    float TOI;
+
+                    if (!JCollision_AABBvsAABB(STEP_BOUNDS, WORLD -> Bodies[CANDIDATES[i]].Bounds)) continue;
+
+                    if (Jubi__SweepStatic2D(START, DISPLACEMENT, WORLD -> Bodies[CANDIDATES[i]].Bounds, &TOI) && TOI < FIRST_TOI) FIRST_TOI = TOI;
+                }
+
+                if (FIRST_TOI <= 1.0f) {
+                    Vector2 HIT = JVector2_Add(FROM, JVector2_Scale(DISPLACEMENT, FIRST_TOI));
+
+                    for (int REST = STEP; REST < STEPS; REST++) PATH[REST] = HIT;
+
+                    PREDICTIONS[p].HitStep = STEP;
+
+                    break;
+                }
+
+                FROM = PATH[STEP];
+            }
+        }
+
+        Jubi__RewindArena(&WORLD -> Scratch, MARK);
+
+        return COUNT;
+    }
+
+    // JCollision_SweepAABBvsAABB, except bodies already touching STATIC (resting on it, or pushed halfway out last step) are stopped straight away if they move further into it
+    static int Jubi__SweepStatic2D(AABB FROM, Vector2 DISPLACEMENT, AABB STATIC, float *TOI) {
+        if (!JCollision_AABBvsAABB(FROM, STATIC)) return JCollision_SweepAABBvsAABB(FROM, DISPLACEMENT, STATIC, TOI, NULL);
+
+        float DEPTH_X = FROM.Max.x - STATIC.Min.x < STATIC.Max.x - FROM.Min.x ? FROM.Max.x - STATIC.Min.x : STATIC.Max.x - FROM.Min.x;
+        float DEPTH_Y = FROM.Max.y - STATIC.Min.y < STATIC.Max.y - FROM.Min.y ? FROM.Max.y - STATIC.Min.y : STATIC.Max.y - FROM.Min.y;
+
+        // Towards STATIC along the axis the overlap is shallowest on
+        float TOWARDS_X = (STATIC.Min.x + STATIC.Max.x) - (FROM.Min.x + FROM.Max.x);
+        float TOWARDS_Y = (STATIC.Min.y + STATIC.Max.y) - (FROM.Min.y + FROM.Max.y);
+
+        int INTO = DEPTH_Y < DEPTH_X ? DISPLACEMENT.y * TOWARDS_Y > 0.0f : DISPLACEMENT.x * TOWARDS_X > 0.0f;
+
+        if (INTO) *TOI = 0.0f;
+
+        return INTO;
+    }
+
+    // World Groups
+
+    // The group only borrows WORLDS, it must outlive the group & the worlds must not be shared between groups
+    JubiWorldGroup2D Jubi_CreateWorldGroup2D(JubiWorld2D **WORLDS, int COUNT) {
+        Jubi__IncrementErrorTick();
+
+        JubiWorldGroup2D GROUP = {0};
+
+        if (WORLDS == NULL || COUNT <= 0) {
+            Jubi__SetError(JUBI_ERROR_NULL_VALUE, __func__);
+
+            return GROUP;
+        }
+
+        GROUP._Order = (int *)JUBI_MALLOC(sizeof(int) * (size_t)COUNT);
+
+        if (GROUP._Order == NULL) {
+            Jubi__SetError(JUBI_ERROR_NULL_VALUE, __func__);
+
+            return GROUP;
+        }
+
+        GROUP.Worlds = WORLDS;
+        GROUP.Count = COUNT;
+
+        for (int i=0; i < COUNT; i++)
+            GROUP._Order[i] = i;
+
+        return GROUP;
+    }
+
+    void Jubi_DestroyWorldGroup2D(JubiWorldGroup2D *GROUP) {
+        if (GROUP == NULL) return;
+
+        JUBI_FREE(GROUP -> _Order);
+
+        *GROUP = (JubiWorldGroup2D){0};
+    }
+
+    static void Jubi__StepGroupTask2D(void *DATA, int INDEX) {
+        JubiWorldGroup2D *GROUP = (JubiWorldGroup2D *)DATA;
+        JubiWorld2D *WORLD = GROUP -> Worlds[GROUP -> _Order[INDEX]];
+
+        if (WORLD != NULL) Jubi_StepWorld2D(WORLD, GROUP -> _DeltaTime);
+    }
+
+    // Each world is stepped exactly as Jubi_StepWorld2D would, worlds never touch each other so no locking is needed. Errors land in the error state of whichever thread stepped the world.
+    void Jubi_StepWorldGroup2D(JubiWorldGroup2D *GROUP, float DeltaTime) {
+        Jubi__IncrementErrorTick();
+
+        if (GROUP == NULL || GROUP -> Worlds == NULL || GROUP -> _Order == NULL) {
+            Jubi__SetError(JUBI_ERROR_NULL_VALUE, __func__);
+
+            return;
+        }
+
+        // Body counts drift slowly between steps, so the previous order is nearly sorted already
+        for (int i=1; i < GROUP -> Count; i++) {
+            int CURRENT = GROUP -> _Order[i];
+            int WEIGHT = GROUP -> Worlds[CURRENT] ? GROUP -> Worlds[CURRENT] -> BodyCount : 0;
+            int j = i - 1;
+
+            while (j >= 0) {
+                JubiWorld2D *OTHER = GROUP -> Worlds[GROUP -> _Order[j]];
+
+                if ((OTHER ? OTHER -> BodyCount : 0) >= WEIGHT) break;
+
+                GROUP -> _Order[j + 1] = GROUP -> _Order[j];
+                j--;
+            }
+
+            GROUP -> _Order[j + 1] = CURRENT;
+        }
+
+        GROUP -> _DeltaTime = DeltaTime;
+
+        Jubi__RunTasks(Jubi__StepGroupTask2D, GROUP, GROUP -> Count);
+    }
+
+    // Global Helpers
+
+    int Jubi_GetBodyIndex(JubiWorld2D *WORLD, Body2D *BODY) {
+        if (Jubi_IsWorldValid(WORLD) != 1 || BODY == NULL) return -1;
+
+        for (int i=0; i < WORLD -> BodyCount; i++)  
+            if (&WORLD -> Bodies[i] == BODY) return i;
+
+        return -1;
+    }
+
+    int Jubi_IsBodyInWorld(JubiWorld2D *WORLD, Body2D *BODY) {
+        if (Jubi_IsWorldValid(WORLD) != 1 || BODY == NULL) return -1;
+
+        for (int i=0; i < WORLD -> BodyCount; i++)
+            if (&WORLD -> Bodies[i] == BODY) return 1;
+
+        return 0;
+    }
+
+    int Jubi_AddBodyToWorld(JubiWorld2D *WORLD, Body2D *BODY) {
+        Jubi__IncrementErrorTick();
+        
+        if (Jubi_IsWorldValid(WORLD) != 1) {
+            Jubi__SetError(Jubi_GetWorldError(Jubi_IsWorldValid(WORLD)), __func__);
+
+            return -1;
+        } else if (BODY == NULL) {
+            Jubi__SetError(JUBI_ERROR_NULL_BODY, __func__);
+
+            return -1;
+        }
+
+        if (WORLD -> BodyCount >= JUBI_MAX_BODIES) {
+            Jubi__SetError(JUBI_ERROR_WORLD_FULL, __func__);
+        
+            return -1;
+        }
+
+        int INDEX = WORLD -> BodyCount++;
+
+        int HANDLE = WORLD -> _FreeHandles[--WORLD -> _FreeHandleCount];
+
+        WORLD -> Bodies[INDEX] = *BODY; 
+        WORLD -> Bodies[INDEX].WORLD = WORLD;
+        WORLD -> Bodies[INDEX].Index = INDEX;
+        WORLD -> Bodies[INDEX].Handle = HANDLE;
+
+        WORLD -> _HandleToIndex[HANDLE] = INDEX;
+
+        WORLD -> _BroadphaseDirty = 1;
+
+        Jubi__RecordBody2D(&WORLD -> Bodies[INDEX], RECORD_ADD, (Vector2){0, 0});
+
+        return INDEX;
+    }
+
+    int Jubi_RemoveBodyFromWorld(JubiWorld2D *WORLD, Body2D *BODY) {
+        Jubi__IncrementErrorTick();
+        
+        if (Jubi_IsWorldValid(WORLD) != 1) {
+            Jubi__SetError(Jubi_GetWorldError(Jubi_IsWorldValid(WORLD)), __func__);
+
+            return -1;
+        } else if (BODY == NULL) {
+            Jubi__SetError(JUBI_ERROR_NULL_BODY, __func__);
+
+            return -1;
+        }
+
+        int INDEX = Jubi_GetBodyIndex(WORLD, BODY);
+        if (INDEX < 0) return 0;
+
+        int HANDLE = WORLD -> Bodies[INDEX].Handle;
+
+        Jubi__RecordBody2D(&WORLD -> Bodies[INDEX], RECORD_REMOVE, (Vector2){0, 0});
+
+        WORLD -> _HandleToIndex[HANDLE] = -1;
+        WORLD -> _FreeHandles[WORLD -> _FreeHandleCount++] = HANDLE;
+
+        for (int i = INDEX; i < WORLD -> BodyCount - 1; i++) {
+            WORLD -> Bodies[i] = WORLD -> Bodies[i + 1];
+            WORLD -> Bodies[i].Index = i;
+            WORLD -> Bodies[i].WORLD = WORLD;
+
+            WORLD -> _HandleToIndex[WORLD -> Bodies[i].Handle] = i;
+        }
+
+        WORLD -> Bodies[WORLD -> BodyCount - 1] = (Body2D){0};
+        WORLD -> BodyCount--;
+
+        WORLD -> _BroadphaseDirty = 1;
+
+        Jubi__DetachJoints2D(WORLD);
+
+        return 1;
+    }
+
+    Body2D *Jubi_GetBodyFromHandle2D(JubiWorld2D *WORLD, int HANDLE) {
+        if (Jubi_IsWorldValid(WORLD) != 1 || HANDLE < 0 || HANDLE >= JUBI_MAX_BODIES) return NULL;
+
+        int INDEX = WORLD -> _HandleToIndex[HANDLE];
+        if (INDEX < 0) return NULL;
+
+        return &WORLD -> Bodies[INDEX];
+    }
+
+    static void Jubi__ResetHandles2D(JubiWorld2D *WORLD) {
+        // Stacked in reverse so a fresh world hands out 0, 1, 2, ...
+        for (int i=0; i < JUBI_MAX_BODIES; i++) {
+            WORLD -> _HandleToIndex[i] = -1;
+            WORLD -> _FreeHandles[i] = JUBI_MAX_BODIES - 1 - i;
+        }
+
+        WORLD -> _FreeHandleCount = JUBI_MAX_BODIES;
+    }
+
+    // Vector2 Math
+
+    Vector2 JVector2_Add(Vector2 A, Vector2 B) {
+        Vector2 RESULT;
+
+        RESULT.x = A.x + B.x;
+        RESULT.y = A.y + B.y;
+
+        return RESULT;
+    }
+
+    Vector2 JVector2_Subtract(Vector2 A, Vector2 B) {
+        Vector2 RESULT;
+
+        RESULT.x = A.x - B.x;
+        RESULT.y = A.y - B.y;
+
+        return RESULT;
+    }
+
+    Vector2 JVector2_Multiply(Vector2 A, Vector2 B) {
+        Vector2 RESULT;
+
+        RESULT.x = A.x * B.x;
+        RESULT.y = A.y * B.y;
+
+        return RESULT;
+    }
+
+    Vector2 JVector2_Divide(Vector2 A, Vector2 B) {
+        Vector2 RESULT;
+
+        RESULT.x = A.x / B.x;
+        RESULT.y = A.y / B.y;
+
+        return RESULT;
+    }
+
+    float JVector2_Length(Vector2 A) {
+        return sqrtf(A.x * A.x + A.y * A.y);
+    }
+
+    Vector2 JVector2_Scale(Vector2 A, float Scalar) {
+        Vector2 RESULT;
+
+        RESULT.x = A.x * Scalar;
+        RESULT.y = A.y * Scalar;
+
+        return RESULT;
+    }
+
+    float JVector2_Dot(Vector2 A, Vector2 B) {
+        return A.x * B.x + A.y * B.y;
+    }
+
+    float JVector2_Cross(Vector2 A, Vector2 B) {
+        return A.x * B.y - A.y * B.x;
+    }
+
+    Vector2 JVector2_Normalize(Vector2 A) {
+        float LENGTH = sqrtf(A.x * A.x + A.y * A.y);
+
+        if (LENGTH == 0)
+            return (Vector2){0, 0};
+
+        A.x /= LENGTH;
+        A.y /= LENGTH;
+
+        return A;
+    }
+
+    float JVector2_Distance(Vector2 A, Vector2 B) {
+        float RESULTX = B.x - A.x;
+        float RESULTY = B.y - A.y;
+
+        return sqrtf(RESULTX * RESULTX + RESULTY * RESULTY);
+    }
+
+    Vector2 JVector2_Direction(Vector2 A, Vector2 B) {
+        Vector2 RESULT;
+
+        RESULT.x = B.x - A.x;
+        RESULT.y = B.y - A.y;
+
+        float LENGTH = sqrtf(RESULT.x * RESULT.x + RESULT.y * RESULT.y);
+
+        if (LENGTH == 0)
+            return (Vector2){0, 0};
+
+        RESULT.x /= LENGTH;
+        RESULT.y /= LENGTH;
+
+        return RESULT;
+    }
+
+    Vector2 JVector_Project(Vector2 A, Vector2 B) {
+        Vector2 RESULT;
+
+        float DOT_PRODUCT = JVector2_Dot(A, B);
+        float B_LENGTH_SQUARED = JVector2_Dot(B, B);
+
+        if (B_LENGTH_SQUARED == 0)
+            return (Vector2){0, 0};
+
+        float SCALAR = DOT_PRODUCT / B_LENGTH_SQUARED;
+
+        RESULT.x = B.x * SCALAR;
+        RESULT.y = B.y * SCALAR;
+
+        return RESULT;
+    }
+
+    Vector2 JVector2_Reflect(Vector2 A, Vector2 NORMAL) {
+        Vector2 RESULT;
+        
+        float DOT_PRODUCT = JVector2_Dot(A, NORMAL);
+
+        RESULT.x = A.x - 2 * DOT_PRODUCT * NORMAL.x;
+        RESULT.y = A.y - 2 * DOT_PRODUCT * NORMAL.y;
+
+        return RESULT;
+    }
+
+    Vector2 JVector2_Perpendicular(Vector2 A) {
+        Vector2 RESULT;
+        
+        RESULT.x = -A.y;
+        RESULT.y = A.x;
+
+        return RESULT;
+    }
+
+    // Vector2 Arrays
+
+    #if defined(JUBI_SIMD_SSE)
+        // Splits 4 interleaved vectors into their x & y lanes
+        #define JUBI__DEINTERLEAVE(V) \
+            __m128 V##_LO = _mm_loadu_ps(&(V)[i].x), V##_HI = _mm_loadu_ps(&(V)[i + 2].x); \
+            __m128 V##_X = _mm_shuffle_ps(V##_LO, V##_HI, _MM_SHUFFLE(2, 0, 2, 0)); \
+            __m128 V##_Y = _mm_shuffle_ps(V##_LO, V##_HI, _MM_SHUFFLE(3, 1, 3, 1))
+
+        #ifdef JUBI_FAST_RSQRT
+            // Estimate + one Newton-Raphson step, ~22 bits of precision
+            static __m128 Jubi__InverseLength4(__m128 LENGTH_SQUARED) {
+                __m128 NONZERO = _mm_cmpgt_ps(LENGTH_SQUARED, _mm_setzero_ps());
+                __m128 ESTIMATE = _mm_rsqrt_ps(LENGTH_SQUARED);
+                __m128 HALF = _mm_mul_ps(_mm_set1_ps(0.5f), LENGTH_SQUARED);
+
+                ESTIMATE = _mm_mul_ps(ESTIMATE, _mm_sub_ps(_mm_set1_ps(1.5f), _mm_mul_ps(HALF, _mm_mul_ps(ESTIMATE, ESTIMATE))));
+
+                return _mm_and_ps(ESTIMATE, NONZERO); // Zero length vectors stay zero
+            }
+        #endif
+    #elif defined(JUBI_SIMD_NEON)
+        static float32x4_t Jubi__InverseLength4(float32x4_t LENGTH_SQUARED) {
+            uint32x4_t NONZERO = vcgtq_f32(LENGTH_SQUARED, vdupq_n_f32(0.0f));
+
+            // NEON has no exact divide on 32-bit ARM, so the estimate is always refined
+            float32x4_t ESTIMATE = vrsqrteq_f32(LENGTH_SQUARED);
+            ESTIMATE = vmulq_f32(ESTIMATE, vrsqrtsq_f32(vmulq_f32(LENGTH_SQUARED, ESTIMATE), ESTIMATE));
+
+            #ifndef JUBI_FAST_RSQRT
+                ESTIMATE = vmulq_f32(ESTIMATE, vrsqrtsq_f32(vmulq_f32(LENGTH_SQUARED, ESTIMATE), ESTIMATE));
+            #endif
+
+            return vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(ESTIMATE), NONZERO));
+        }
+    #endif
+
+    // OUT may alias A or B in all the array functions
+
+    void JVector2_AddArray(const Vector2 *A, const Vector2 *B, Vector2 *OUT, int COUNT) {
+        int i = 0;
+
+        #if defined(JUBI_SIMD_SSE)
+            for (; i + 2 <= COUNT; i += 2)
+                _mm_storeu_ps(&OUT[i].x, _mm_add_ps(_mm_loadu_ps(&A[i].x), _mm_loadu_ps(&B[i].x)));
+        #elif defined(JUBI_SIMD_NEON)
+            for (; i + 2 <= COUNT; i += 2)
+                vst1q_f32(&OUT[i].x, vaddq_f32(vld1q_f32(&A[i].x), vld1q_f32(&B[i].x)));
+        #endif
+
+        for (; i < COUNT; i++)
+            OUT[i] = JVector2_Add(A[i], B[i]);
+    }
+
+    void JVector2_SubtractArray(const Vector2 *A, const Vector2 *B, Vector2 *OUT, int COUNT) {
+        int i = 0;
+
+        #if defined(JUBI_SIMD_SSE)
+            for (; i + 2 <= COUNT; i += 2)
+                _mm_storeu_ps(&OUT[i].x, _mm_sub_ps(_mm_loadu_ps(&A[i].x), _mm_loadu_ps(&B[i].x)));
+        #elif defined(JUBI_SIMD_NEON)
+            for (; i + 2 <= COUNT; i += 2)
+                vst1q_f32(&OUT[i].x, vsubq_f32(vld1q_f32(&A[i].x), vld1q_f32(&B[i].x)));
+        #endif
+
+        for (; i < COUNT; i++)
+            OUT[i] = JVector2_Subtract(A[i], B[i]);
+    }
+
+    void JVector2_ScaleArray(const Vector2 *A, float Scalar, Vector2 *OUT, int COUNT) {
+        int i = 0;
+
+        #if defined(JUBI_SIMD_SSE)
+            __m128 SCALE = _mm_set1_ps(Scalar);
+
+            for (; i + 2 <= COUNT; i += 2)
+                _mm_storeu_ps(&OUT[i].x, _mm_mul_ps(_mm_loadu_ps(&A[i].x), SCALE));
+        #elif defined(JUBI_SIMD_NEON)
+            for (; i + 2 <= COUNT; i += 2)
+                vst1q_f32(&OUT[i].x, vmulq_n_f32(vld1q_f32(&A[i].x), Scalar));
+        #endif
+
+        for (; i < COUNT; i++)
+            OUT[i] = JVector2_Scale(A[i], Scalar);
+    }
+
+    void JVector2_DotArray(const Vector2 *A, const Vector2 *B, float *OUT, int COUNT) {
+        int i = 0;
+
+        #if defined(JUBI_SIMD_SSE)
+            for (; i + 4 <= COUNT; i += 4) {
+                JUBI__DEINTERLEAVE(A);
+                JUBI__DEINTERLEAVE(B);
+
+                _mm_storeu_ps(&OUT[i], _mm_add_ps(_mm_mul_ps(A_X, B_X), _mm_mul_ps(A_Y, B_Y)));
+            }
+        #elif defined(JUBI_SIMD_NEON)
+            for (; i + 4 <= COUNT; i += 4) {
+                float32x4x2_t VA = vld2q_f32(&A[i].x), VB = vld2q_f32(&B[i].x);
+
+                vst1q_f32(&OUT[i], vaddq_f32(vmulq_f32(VA.val[0], VB.val[0]), vmulq_f32(VA.val[1], VB.val[1])));
+            }
+        #endif
+
+        for (; i < COUNT; i++)
+            OUT[i] = JVector2_Dot(A[i], B[i]);
+    }
+
+    void JVector2_LengthArray(const Vector2 *A, float *OUT, int COUNT) {
+        int i = 0;
+
+        #if defined(JUBI_SIMD_SSE)
+            for (; i + 4 <= COUNT; i += 4) {
+                JUBI__DEINTERLEAVE(A);
+
+                _mm_storeu_ps(&OUT[i], _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(A_X, A_X), _mm_mul_ps(A_Y, A_Y))));
+            }
+        #elif defined(JUBI_SIMD_NEON) && defined(__aarch64__)
+            for (; i + 4 <= COUNT; i += 4) {
+                float32x4x2_t VA = vld2q_f32(&A[i].x);
+
+                vst1q_f32(&OUT[i], vsqrtq_f32(vaddq_f32(vmulq_f32(VA.val[0], VA.val[0]), vmulq_f32(VA.val[1], VA.val[1]))));
+            }
+        #endif
+
+        for (; i < COUNT; i++)
+            OUT[i] = JVector2_Length(A[i]);
+    }
+
+    void JVector2_DistanceArray(const Vector2 *A, const Vector2 *B, float *OUT, int COUNT) {
+        int i = 0;
+
+        #if defined(JUBI_SIMD_SSE)
+            for (; i + 4 <= COUNT; i += 4) {
+                JUBI__DEINTERLEAVE(A);
+                JUBI__DEINTERLEAVE(B);
+
+                __m128 DX = _mm_sub_ps(B_X, A_X);
+                __m128 DY = _mm_sub_ps(B_Y, A_Y);
+
+                _mm_storeu_ps(&OUT[i], _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(DX, DX), _mm_mul_ps(DY, DY))));
+            }
+        #elif defined(JUBI_SIMD_NEON) && defined(__aarch64__)
+            for (; i + 4 <= COUNT; i += 4) {
+                float32x4x2_t VA = vld2q_f32(&A[i].x), VB = vld2q_f32(&B[i].x);
+                float32x4_t DX = vsubq_f32(VB.val[0], VA.val[0]);
+                float32x4_t DY = vsubq_f32(VB.val[1], VA.val[1]);
+
+                vst1q_f32(&OUT[i], vsqrtq_f32(vaddq_f32(vmulq_f32(DX, DX), vmulq_f32(DY, DY))));
+            }
+        #endif
+
+        for (; i < COUNT; i++)
+            OUT[i] = JVector2_Distance(A[i], B[i]);
+    }
+
+    // Zero length vectors come out as (0, 0). With JUBI_FAST_RSQRT (or on NEON) the SIMD lanes use a refined reciprocal square root estimate instead of a divide, so results can differ from JVector2_Normalize in the last few bits.
+    void JVector2_NormalizeArray(const Vector2 *A, Vector2 *OUT, int COUNT) {
+        int i = 0;
+
+        #if defined(JUBI_SIMD_SSE)
+            for (; i + 4 <= COUNT; i += 4) {
+                JUBI__DEINTERLEAVE(A);
+
+                __m128 LENGTH_SQUARED = _mm_add_ps(_mm_mul_ps(A_X, A_X), _mm_mul_ps(A_Y, A_Y));
+                __m128 X, Y;
+
+                #ifdef JUBI_FAST_RSQRT
+                    __m128 INVERSE = Jubi__InverseLength4(LENGTH_SQUARED);
+
+                    X = _mm_mul_ps(A_X, INVERSE);
+                    Y = _mm_mul_ps(A_Y, INVERSE);
+                #else
+                    // Divide rather than multiply by the inverse, so this matches JVector2_Normalize exactly
+                    __m128 NONZERO = _mm_cmpgt_ps(LENGTH_SQUARED, _mm_setzero_ps());
+                    __m128 LENGTH = _mm_sqrt_ps(LENGTH_SQUARED);
+
+                    X = _mm_and_ps(_mm_div_ps(A_X, LENGTH), NONZERO);
+                    Y = _mm_and_ps(_mm_div_ps(A_Y, LENGTH), NONZERO);
+                #endif
+
+                _mm_storeu_ps(&OUT[i].x, _mm_unpacklo_ps(X, Y));
+                _mm_storeu_ps(&OUT[i + 2].x, _mm_unpackhi_ps(X, Y));
+            }
+        #elif defined(JUBI_SIMD_NEON)
+            for (; i + 4 <= COUNT; i += 4) {
+                float32x4x2_t VA = vld2q_f32(&A[i].x);
+                float32x4_t INVERSE = Jubi__InverseLength4(vaddq_f32(vmulq_f32(VA.val[0], VA.val[0]), vmulq_f32(VA.val[1], VA.val[1])));
+
+                VA.val[0] = vmulq_f32(VA.val[0], INVERSE);
+                VA.val[1] = vmulq_f32(VA.val[1], INVERSE);
+
+                vst2q_f32(&OUT[i].x, VA);
+            }
+        #endif
+
+        for (; i < COUNT; i++)
+            OUT[i] = JVector2_Normalize(A[i]);
+    }
+
+    #if defined(JUBI_SIMD_SSE)
+        #undef JUBI__DEINTERLEAVE
+    #endif
+    
+    float JClamp(float Value, float MIN, float MAX) {
+        if (Value < MIN) return MIN;
+        if (Value > MAX) return MAX;
+
+        return Value;
+    }
+
+    // Global Initializers
+
+    // Collision Initializers
+
+    AABB JInitialize_AABB(Vector2 Position, Vector2 Size) {
+        Vector2 Half = {Size.x * .5f, Size.y * .5f};
+
+        AABB Box;
+
+        Box.Min.x = Position.x - Half.x;
+        Box.Min.y = Position.y - Half.y;
+        Box.Max.x = Position.x + Half.x;
+        Box.Max.y = Position.y + Half.y;
+
+        return Box;
+    }
+
+    // Vector2 Initializers
+
+    Body2D JBody2D_Init(Vector2 Position, Vector2 Size, Shape2D Shape, BodyType2D Type, float Mass) {
+        Body2D BODY;
+
+        Jubi__InitBody2D(&BODY, Position, Size, Shape, Type, Mass);
+
+        return BODY;
+    }
+
+    static void Jubi__InitBody2D(Body2D *BODY, Vector2 Position, Vector2 Size, Shape2D Shape, BodyType2D Type, float Mass) {
+        *BODY = (Body2D){0};
+
+        BODY -> Position = Position;
+        BODY -> Velocity = (Vector2){0, 0};
+        BODY -> _Size = Size;
+        BODY -> Shape = Shape;
+        BODY -> Type = Type;
+
+        BODY -> Mass = Mass;
+        BODY -> InvMass = (Mass > 0.0f && Type != BODY_KINEMATIC) ? (1.0f / Mass) : 0.0f;
+        BODY -> Restitution = 0.0f;
+        BODY -> Friction = 0.0f;
+
+        BODY -> Bounds = JInitialize_AABB(Position, Size);
+
+        BODY -> Flags = 0;
+        BODY -> ShapeId = -1;
+
+        BODY -> Index = -1;
+        BODY -> Handle = JUBI_INVALID_HANDLE;
+        BODY -> WORLD = NULL;
+    }
+
+    Body2D *JBody2D_CreateBox(JubiWorld2D *WORLD, Vector2 Position, Vector2 Size, BodyType2D Type, float Mass) {
+        Jubi__IncrementErrorTick();
+        
+        Body2D BODY = JBody2D_Init(Position, Size, SHAPE_BOX, Type, Mass);
+
+        if (WORLD == NULL) {
+            Jubi__SetError(JUBI_ERROR_NULL_WORLD, __func__);
+
+            return NULL;
+        }
+        
+        if (Jubi_IsWorldValid(WORLD) != 1) {
+            Jubi__SetError(Jubi_GetWorldError(Jubi_IsWorldValid(WORLD)), __func__);
+
+            return NULL;
+        }
+
+        int INDEX = Jubi_AddBodyToWorld(WORLD, &BODY);
+        if (INDEX < 0) return NULL;  
+
+        WORLD -> Bodies[INDEX].Index = INDEX;
+        WORLD -> Bodies[INDEX].WORLD = WORLD;
+
+        return &WORLD -> Bodies[INDEX];
+    }
+
+    Body2D *JBody2D_CreateCircle(JubiWorld2D *WORLD, Vector2 Position, Vector2 Size, BodyType2D Type, float Mass) {
+        Jubi__IncrementErrorTick();
+        
+        Body2D BODY = JBody2D_Init(Position, Size, SHAPE_CIRCLE, Type, Mass);
+
+        if (WORLD == NULL) {
+            Jubi__SetError(JUBI_ERROR_NULL_WORLD, __func__);
+
+            return NULL;
+        }
+        
+        if (Jubi_IsWorldValid(WORLD) != 1) {
+            Jubi__SetError(Jubi_GetWorldError(Jubi_IsWorldValid(WORLD)), __func__);
+
+            return NULL;
+        }
+
+        int INDEX = Jubi_AddBodyToWorld(WORLD, &BODY);
+        if (INDEX < 0) return NULL;
+
+        WORLD -> Bodies[INDEX].Index = INDEX;
+        WORLD -> Bodies[INDEX].WORLD = WORLD;
+
+        return &WORLD -> Bodies[INDEX];
+    }
+
+    // Body from a shared shape, its _Size & Shape are copied from the shape for code that reads them directly
+    Body2D *JBody2D_CreateFromShape(JubiWorld2D *WORLD, Vector2 Position, int ShapeId, BodyType2D Type, float Mass) {
+        Jubi__IncrementErrorTick();
+
+        if (Jubi_IsWorldValid(WORLD) != 1) {
+            Jubi__SetError(Jubi_GetWorldError(Jubi_IsWorldValid(WORLD)), __func__);
+
+            return NULL;
+        } else if (ShapeId < 0 || ShapeId >= WORLD -> ShapeCount) {
+            Jubi__SetError(JUBI_ERROR_INVALID_VALUE, __func__);
+
+            return NULL;
+        }
+
+        const JubiShape2D *SHAPE = &WORLD -> Shapes[ShapeId];
+
+        Body2D BODY = JBody2D_Init(Position, SHAPE -> Size, SHAPE -> Type, Type, Mass);
+        BODY.ShapeId = ShapeId;
+
+        int INDEX = Jubi_AddBodyToWorld(WORLD, &BODY);
+        if (INDEX < 0) return NULL;
+
+        return &WORLD -> Bodies[INDEX];
+    }
+
+    Body2D *JBody2D_CreatePolygon(JubiWorld2D *WORLD, Vector2 Position, const Vector2 *VERTICES, int COUNT, BodyType2D Type, float Mass) {
+        int SHAPE = Jubi_CreatePolygonShape2D(WORLD, VERTICES, COUNT);
+        if (SHAPE < 0) return NULL;
+
+        return JBody2D_CreateFromShape(WORLD, Position, SHAPE, Type, Mass);
+    }
+
+    // Bulk Creation
+
+    // Validates once & writes every body straight into world storage. Bodies land at contiguous indices, returned as a range, & their handles are written to OUT_HANDLES if it isn't NULL. Nothing is created if the whole batch doesn't fit.
+    JubiBodyRange2D JBody2D_CreateBatch(JubiWorld2D *WORLD, const JubiBodyBatch2D *BATCH, int COUNT, int *OUT_HANDLES) {
+        Jubi__IncrementErrorTick();
+
+        JubiBodyRange2D RANGE = {-1, 0};
+
+        if (Jubi_IsWorldValid(WORLD) != 1) {
+            Jubi__SetError(Jubi_GetWorldError(Jubi_IsWorldValid(WORLD)), __func__);
+
+            return RANGE;
+        } else if (BATCH == NULL || BATCH -> Positions == NULL || (BATCH -> Sizes == NULL && BATCH -> ShapeIds == NULL)) {
+            Jubi__SetError(JUBI_ERROR_NULL_VALUE, __func__);
+
+            return RANGE;
+        } else if (COUNT < 0) {
+            Jubi__SetError(JUBI_ERROR_INVALID_VALUE, __func__);
+
+            return RANGE;
+        }
+
+        if (COUNT > JUBI_MAX_BODIES - WORLD -> BodyCount) {
+            Jubi__SetError(JUBI_ERROR_WORLD_FULL, __func__);
+
+            return RANGE;
+        }
+
+        if (BATCH -> ShapeIds) {
+            for (int i=0; i < COUNT; i++) {
+                if (BATCH -> ShapeIds[i] < 0 || BATCH -> ShapeIds[i] >= WORLD -> ShapeCount) {
+                    Jubi__SetError(JUBI_ERROR_INVALID_VALUE, __func__);
+
+                    return RANGE;
+                }
+            }
+        }
+
+        RANGE.First = WORLD -> BodyCount;
+        RANGE.Count = COUNT;
+
+        for (int i=0; i < COUNT; i++) {
+            int INDEX = RANGE.First + i;
+            int HANDLE = WORLD -> _FreeHandles[--WORLD -> _FreeHandleCount];
+
+            Body2D *BODY = &WORLD -> Bodies[INDEX];
+
+            BodyType2D TYPE = BATCH -> Types ? BATCH -> Types[i] : BODY_DYNAMIC;
+            float MASS = BATCH -> Masses ? BATCH -> Masses[i] : 1.0f;
+
+            if (BATCH -> ShapeIds) {
+                const JubiShape2D *SHAPE = &WORLD -> Shapes[BATCH -> ShapeIds[i]];
+
+                Jubi__InitBody2D(BODY, BATCH -> Positions[i], SHAPE -> Size, SHAPE -> Type, TYPE, MASS);
+                BODY -> ShapeId = BATCH -> ShapeIds[i];
+            } else {
+                Jubi__InitBody2D(BODY, BATCH -> Positions[i], BATCH -> Sizes[i], BATCH -> Shapes ? BATCH -> Shapes[i] : SHAPE_BOX, TYPE, MASS);
+            }
+
+            BODY -> Index = INDEX;
+            BODY -> Handle = HANDLE;
+            BODY -> WORLD = WORLD;
+
+            WORLD -> _HandleToIndex[HANDLE] = INDEX;
+
+            if (OUT_HANDLES) OUT_HANDLES[i] = HANDLE;
+        }
+
+        WORLD -> BodyCount += COUNT;
+        WORLD -> _BroadphaseDirty = 1;
+
+        for (int i=0; i < COUNT; i++)
+            Jubi__RecordBody2D(&WORLD -> Bodies[RANGE.First + i], RECORD_ADD, (Vector2){0, 0});
+
+        return RANGE;
+    }
+
+    // Removes every body in HANDLES with a single compaction pass, keeping the remaining bodies in order. Unknown or repeated handles are skipped. Returns the number of bodies removed.
+    int JBody2D_DestroyBatch(JubiWorld2D *WORLD, const int *HANDLES, int COUNT) {
+        Jubi__IncrementErrorTick();
+
+        if (Jubi_IsWorldValid(WORLD) != 1) {
+            Jubi__SetError(Jubi_GetWorldError(Jubi_IsWorldValid(WORLD)), __func__);
+
+            return -1;
+        } else if (HANDLES == NULL && COUNT > 0) {
+            Jubi__SetError(JUBI_ERROR_NULL_VALUE, __func__);
+
+            return -1;
+        }
+
+        JUBI_UINT8 REMOVE[JUBI_MAX_BODIES] = {0};
+        int REMOVED = 0;
+
+        for (int i=0; i < COUNT; i++) {
+            int HANDLE = HANDLES[i];
+            if (HANDLE < 0 || HANDLE >= JUBI_MAX_BODIES) continue;
+
+            int INDEX = WORLD -> _HandleToIndex[HANDLE];
+            if (INDEX < 0) continue;
+
+            Jubi__RecordBody2D(&WORLD -> Bodies[INDEX], RECORD_REMOVE, (Vector2){0, 0});
+
+            REMOVE[INDEX] = 1;
+            REMOVED++;
+
+            WORLD -> _HandleToIndex[HANDLE] = -1;
+            WORLD -> _FreeHandles[WORLD -> _FreeHandleCount++] = HANDLE;
+        }
+
+        if (REMOVED == 0) return 0;
+
+        int WRITE = 0;
+
+        for (int READ = 0; READ < WORLD -> BodyCount; READ++) {
+            if (REMOVE[READ]) continue;
+
+            if (WRITE != READ) {
+                WORLD -> Bodies[WRITE] = WORLD -> Bodies[READ];
+                WORLD -> Bodies[WRITE].Index = WRITE;
+
+                WORLD -> _HandleToIndex[WORLD -> Bodies[WRITE].Handle] = WRITE;
+            }
+
+            WRITE++;
+        }
+
+        for (int i = WRITE; i < WORLD -> BodyCount; i++)
+            WORLD -> Bodies[i] = (Body2D){0};
+
+        WORLD -> BodyCount = WRITE;
+        WORLD -> _BroadphaseDirty = 1;
+
+        Jubi__DetachJoints2D(WORLD);
+
+        return REMOVED;
+    }
+
+    // Vector2 Physics
+
+    void JBody2D_ApplyForce(Body2D *BODY, Vector2 FORCE) {
+        Jubi__IncrementErrorTick();
+        
+        if (BODY == NULL || BODY -> Type != BODY_DYNAMIC) {
+            Jubi__SetError(JUBI_ERROR_BODY_NOT_VALID, __func__);
+            
+            return;
+        }
+
+        BODY -> AccumulatedForce.x += FORCE.x;
+        BODY -> AccumulatedForce.y += FORCE.y;
+
+        Jubi__RecordBody2D(BODY, RECORD_FORCE, FORCE);
+    }
+
+    void JBody2D_ApplyImpulse(Body2D *BODY, Vector2 IMPULSE) {
+        Jubi__IncrementErrorTick();
+        
+        if (BODY == NULL || BODY -> Type != BODY_DYNAMIC) {
+            Jubi__SetError(JUBI_ERROR_BODY_NOT_VALID, __func__);
+            
+            return;
+        }
+
+        if (BODY -> Mass > 0) {
+            BODY -> Velocity.x += IMPULSE.x * BODY -> InvMass;
+            BODY -> Velocity.y += IMPULSE.y * BODY -> InvMass;
+        }
+
+        Jubi__RecordBody2D(BODY, RECORD_IMPULSE, IMPULSE);
+    }
+
+    void JBody2D_SetBullet(Body2D *BODY, int ENABLED) {
+        Jubi__IncrementErrorTick();
+
+        if (BODY == NULL) {
+            Jubi__SetError(JUBI_ERROR_NULL_BODY, __func__);
+
+            return;
+        }
+
+        if (ENABLED) BODY -> Flags |= JUBI_BODY_BULLET;
+        else BODY -> Flags &= ~JUBI_BODY_BULLET;
+    }
+
+    // Static sensors (pickups, damage zones) are never integrated, dynamic ones (aggro radii following an enemy) still move but nothing collides with them
+    void JBody2D_SetSensor(Body2D *BODY, int ENABLED) {
+        Jubi__IncrementErrorTick();
+
+        if (BODY == NULL) {
+            Jubi__SetError(JUBI_ERROR_NULL_BODY, __func__);
+
+            return;
+        }
+
+        if (ENABLED) BODY -> Flags |= JUBI_BODY_SENSOR;
+        else BODY -> Flags &= ~JUBI_BODY_SENSOR;
+    }
+
+    Vector2 JVector2_ApplyGravity(Body2D *Body, float DeltaTime) {
+        Jubi__IncrementErrorTick();
+        
+        if (Body == NULL || Body -> Type != BODY_DYNAMIC) {
+            Jubi__SetError(JUBI_ERROR_BODY_NOT_VALID, __func__);
+            
+            return (Vector2){0};
+        }
+
+        if (DeltaTime <= 0) DeltaTime = 0.033f;
+
+        Vector2 GravityForce = (Vector2){0, Body -> Mass * GRAVITY};
+
+        JBody2D_ApplyForce(Body, GravityForce);
+
+        return Body -> AccumulatedForce;
+    }
+
+    void Jubi_IntegrateBody(Body2D *BODY, float DeltaTime, float Gravity) {
+        Jubi__IncrementErrorTick();
+
+        if (BODY == NULL) {
+            Jubi__SetError(JUBI_ERROR_NULL_BODY, __func__);
+            
+            return;
+        } else if (DeltaTime <= 0.0f) {
+            Jubi__SetError(JUBI_ERROR_INVALID_VALUE, __func__);
+            
+            return;
+        }
+
+        Jubi__IntegrateBody2D(BODY, DeltaTime, (Vector2){0, 0}, 1.0f - AIR_RESISTANCE);
+    }
+
+    // Jubi_IntegrateBody without the validation & error bookkeeping, for the world step. UniformForce is added to every dynamic body alongside gravity.
+    // Drag is what the velocity is multiplied by, (1 - AIR_RESISTANCE) for a full step
+    static void Jubi__IntegrateBody2D(Body2D *BODY, float DeltaTime, Vector2 UniformForce, float Drag) {
+        if (BODY -> Type == BODY_DYNAMIC && BODY -> InvMass > 0.0f && !(BODY -> Flags & JUBI_BODY_HELD)) {
+            BODY -> AccumulatedForce.y += BODY -> Mass * GRAVITY;
+
+            BODY -> AccumulatedForce.x += UniformForce.x;
+            BODY -> AccumulatedForce.y += UniformForce.y;
+
+            Vector2 Acceleration = {
+                BODY -> AccumulatedForce.x * BODY -> InvMass,
+                BODY -> AccumulatedForce.y * BODY -> InvMass,
+            };
+
+            BODY -> Velocity.x += Acceleration.x * DeltaTime;
+            BODY -> Velocity.y += Acceleration.y * DeltaTime;
+
+            BODY -> Velocity.x *= Drag;
+            BODY -> Velocity.y *= Drag;
+
+            BODY -> Position.x += BODY -> Velocity.x * DeltaTime;
+            BODY -> Position.y += BODY -> Velocity.y * DeltaTime;
+
+            BODY -> AccumulatedForce = (Vector2){0};
+        } else if (BODY -> Type == BODY_KINEMATIC && !(BODY -> Flags & JUBI_BODY_HELD)) {
+            // No gravity, forces or drag, the velocity is whatever was set
+            BODY -> Position.x += BODY -> Velocity.x * DeltaTime;
+            BODY -> Position.y += BODY -> Velocity.y * DeltaTime;
+        }
+
+        Jubi__UpdateBounds2D(BODY);
+    }
+
+    static void Jubi__UpdateBounds2D(Body2D *BODY) {
+        if (BODY -> ShapeId >= 0 && BODY -> WORLD) {
+            const JubiShape2D *SHAPE = &BODY -> WORLD -> Shapes[BODY -> ShapeId];
+
+            float CENTER_X = BODY -> Position.x + SHAPE -> Offset.x;
+            float CENTER_Y = BODY -> Position.y + SHAPE -> Offset.y;
+
+            BODY -> Bounds.Min.x = CENTER_X - SHAPE -> HalfSize.x;
+            BODY -> Bounds.Min.y = CENTER_Y - SHAPE -> HalfSize.y;
+            BODY -> Bounds.Max.x = CENTER_X + SHAPE -> HalfSize.x;
+            BODY -> Bounds.Max.y = CENTER_Y + SHAPE -> HalfSize.y;
+
+            return;
+        }
+
+        BODY -> Bounds = JInitialize_AABB(BODY -> Position, BODY -> _Size);
+    }
+
+    void Jubi_StepBody2D(Body2D *BODY, float DeltaTime, float Gravity) {
+        Jubi_IntegrateBody(BODY, DeltaTime, BODY -> WORLD ? BODY -> WORLD -> Gravity : GRAVITY);
+    }
+
+    // Vector2 Collision Detection
+
+    int JCollision_AABBvsAABB(const AABB A, const AABB B) {
+        return (A.Min.x < B.Max.x && A.Max.x > B.Min.x && A.Min.y < B.Max.y && A.Max.y > B.Min.y) ? 1 : 0;
+    }
+
+    int JCollision_CirclevsCircle(Circle2D A, Circle2D B) {
+        float DISTANCE = JVector2_Distance(A.Center, B.Center);
+        float RADIUS_SUM = A.Radius + B.Radius;
+
+        if (DISTANCE < RADIUS_SUM)
+            return 1;
+
+        return 0;
+    }
+
+    int JCollision_AABBvsCircle(AABB A, Circle2D B) {
+        float CLOSEST_X = JClamp(B.Center.x, A.Min.x, A.Max.x);
+        float CLOSEST_Y = JClamp(B.Center.y, A.Min.y, A.Max.y);
+
+        float DISTANCE_X = B.Center.x - CLOSEST_X;
+        float DISTANCE_Y = B.Center.y - CLOSEST_Y;
+
+        float DISTANCE_SQUARED = (DISTANCE_X * DISTANCE_X) + (DISTANCE_Y * DISTANCE_Y);
+        float RADIUS_SQUARED = B.Radius * B.Radius;
+
+        if (DISTANCE_SQUARED < RADIUS_SQUARED)
+            return 1;
+
+        return 0;
+    }
+
+    // Time of impact of A moving by DISPLACEMENT against a stationary B, as a fraction of DISPLACEMENT in [0, 1]. Returns 0 if they don't meet, or already overlap at the start (that's left to the discrete resolver).
+    int JCollision_SweepAABBvsAABB(AABB A, Vector2 DISPLACEMENT, AABB B, float *TOI, Vector2 *NORMAL) {
+        float ENTER = -INFINITY, EXIT = INFINITY;
+        Vector2 HIT_NORMAL = {0, 0};
+
+        float A_MIN[2] = {A.Min.x, A.Min.y}, A_MAX[2] = {A.Max.x, A.Max.y};
+        float B_MIN[2] = {B.Min.x, B.Min.y}, B_MAX[2] = {B.Max.x, B.Max.y};
+        float MOTION[2] = {DISPLACEMENT.x, DISPLACEMENT.y};
+
+        for (int Axis = 0; Axis < 2; Axis++) {
+            if (MOTION[Axis] == 0.0f) {
+                if (A_MAX[Axis] <= B_MIN[Axis] || A_MIN[Axis] >= B_MAX[Axis]) return 0;
+
+                continue;
+            }
+
+            float AXIS_ENTER, AXIS_EXIT;
+
+            if (MOTION[Axis] > 0.0f) {
+                AXIS_ENTER = (B_MIN[Axis] - A_MAX[Axis]) / MOTION[Axis];
+                AXIS_EXIT = (B_MAX[Axis] - A_MIN[Axis]) / MOTION[Axis];
+            } else {
+                AXIS_ENTER = (B_MAX[Axis] - A_MIN[Axis]) / MOTION[Axis];
+                AXIS_EXIT = (B_MIN[Axis] - A_MAX[Axis]) / MOTION[Axis];
+            }
+
+            if (AXIS_ENTER > ENTER) {
+                ENTER = AXIS_ENTER;
+
+                HIT_NORMAL = (Vector2){0, 0};
+                if (Axis == 0) HIT_NORMAL.x = MOTION[Axis] > 0.0f ? -1.0f : 1.0f;
+                else HIT_NORMAL.y = MOTION[Axis] > 0.0f ? -1.0f : 1.0f;
+            }
+
+            if (AXIS_EXIT < EXIT) EXIT = AXIS_EXIT;
+        }
+
+        if (ENTER > EXIT || ENTER < 0.0f || ENTER > 1.0f) return 0;
+
+        if (TOI) *TOI = ENTER;
+        if (NORMAL) *NORMAL = HIT_NORMAL;
+
+        return 1;
+    }
+
+    int JCollision_SweepCirclevsCircle(Circle2D A, Vector2 DISPLACEMENT, Circle2D B, float *TOI, Vector2 *NORMAL) {
+        Vector2 OFFSET = JVector2_Subtract(A.Center, B.Center);
+        float RADIUS_SUM = A.Radius + B.Radius;
+
+        // |OFFSET + DISPLACEMENT * t| = RADIUS_SUM
+        float QA = JVector2_Dot(DISPLACEMENT, DISPLACEMENT);
+        float QB = 2.0f * JVector2_Dot(OFFSET, DISPLACEMENT);
+        float QC = JVector2_Dot(OFFSET, OFFSET) - RADIUS_SUM * RADIUS_SUM;
+
+        if (QC < 0.0f || QA == 0.0f || QB >= 0.0f) return 0;
+
+        float DISCRIMINANT = QB * QB - 4.0f * QA * QC;
+        if (DISCRIMINANT < 0.0f) return 0;
+
+        float T = (-QB - sqrtf(DISCRIMINANT)) / (2.0f * QA);
+        if (T < 0.0f || T > 1.0f) return 0;
+
+        if (TOI) *TOI = T;
+        if (NORMAL) *NORMAL = JVector2_Direction(B.Center, JVector2_Add(A.Center, JVector2_Scale(DISPLACEMENT, T)));
+
+        return 1;
+    }
+
+    void JCollision_ResolveAABBvsAABB(Body2D *A, Body2D *B) {
+        if (!A || !B) return;
+        
+        float OverlapX = fminf(A -> Bounds.Max.x, B -> Bounds.Max.x) - fmaxf(A -> Bounds.Min.x, B -> Bounds.Min.x);
+        float OverlapY = fminf(A -> Bounds.Max.y, B -> Bounds.Max.y) - fmaxf(A -> Bounds.Min.y, B -> Bounds.Min.y);
+
+        if (OverlapX <= 0 || OverlapY <= 0) return;
+        if (OverlapX < OverlapY) {
+            float Push = OverlapX * 0.5f;
+
+            // Push A away from the side B is on
+            if (A -> Bounds.Min.x + A -> Bounds.Max.x > B -> Bounds.Min.x + B -> Bounds.Max.x) Push = -Push;
+
+            if (A -> InvMass > 0) A -> Position.x -= Push * (A -> InvMass / (A -> InvMass + B->InvMass > 0 ? (A -> InvMass + B -> InvMass) : 1));
+            if (B -> InvMass > 0) B -> Position.x += Push * (B -> InvMass / (A -> InvMass + B->InvMass > 0 ? (A -> InvMass + B -> InvMass) : 1));
+
+            A -> Velocity.x = 0; B->Velocity.x = 0;
+        } else {
+            float Push = OverlapY * 0.5f;
+
+            if (A -> Bounds.Min.y + A -> Bounds.Max.y > B -> Bounds.Min.y + B -> Bounds.Max.y) Push = -Push;
+
+            if (A -> InvMass > 0) A -> Position.y -= Push * (A -> InvMass / (A -> InvMass + B -> InvMass > 0 ? (A -> InvMass + B -> InvMass) : 1));
+            if (B -> InvMass > 0) B -> Position.y += Push * (B -> InvMass / (A -> InvMass + B -> InvMass > 0 ? (A -> InvMass + B -> InvMass) : 1));
+
+            A -> Velocity.y = 0; B -> Velocity.y = 0;
+        }
+
+        Jubi__UpdateBounds2D(A);
+        Jubi__UpdateBounds2D(B);
+    }
+
+    // Pushes A & B apart along the manifold normal, split by inverse mass, & removes the velocity closing them together
+    void JCollision_ResolveManifold(Body2D *A, Body2D *B, const JubiManifold2D *MANIFOLD) {
+        if (!A || !B || !MANIFOLD) return;
+
+        float TOTAL_INV_MASS = A -> InvMass + B -> InvMass;
+        if (TOTAL_INV_MASS <= 0.0f) return;
+
+        Vector2 NORMAL = MANIFOLD -> Normal;
+        float CORRECTION = MANIFOLD -> Depth / TOTAL_INV_MASS;
+
+        A -> Position = JVector2_Subtract(A -> Position, JVector2_Scale(NORMAL, CORRECTION * A -> InvMass));
+        B -> Position = JVector2_Add(B -> Position, JVector2_Scale(NORMAL, CORRECTION * B -> InvMass));
+
+        float CLOSING = JVector2_Dot(JVector2_Subtract(B -> Velocity, A -> Velocity), NORMAL);
+
+        if (CLOSING < 0.0f) {
+            float IMPULSE = -CLOSING / TOTAL_INV_MASS;
+
+            A -> Velocity = JVector2_Subtract(A -> Velocity, JVector2_Scale(NORMAL, IMPULSE * A -> InvMass));
+            B -> Velocity = JVector2_Add(B -> Velocity, JVector2_Scale(NORMAL, IMPULSE * B -> InvMass));
+        }
+
+        Jubi__UpdateBounds2D(A);
+        Jubi__UpdateBounds2D(B);
+    }
+
+    // Polygons
+
+    // Copies VERTICES, flipping clockwise input to counter-clockwise, & precomputes edge normals. Returns 0 if there are too few/many vertices or they aren't convex.
+    int JPolygon2D_Init(JubiPolygon2D *POLYGON, const Vector2 *VERTICES, int COUNT) {
+        if (POLYGON == NULL || VERTICES == NULL) return 0;
+        if (COUNT < 3 || COUNT > JUBI_MAX_POLYGON_VERTICES) return 0;
+
+        float AREA = 0.0f;
+
+        for (int i=0; i < COUNT; i++)
+            AREA += JVector2_Cross(VERTICES[i], VERTICES[(i + 1) % COUNT]);
+
+        if (AREA == 0.0f) return 0;
+
+        for (int i=0; i < COUNT; i++)
+            POLYGON -> Vertices[i] = VERTICES[AREA > 0.0f ? i : COUNT - 1 - i];
+
+        POLYGON -> Count = COUNT;
+
+        for (int i=0; i < COUNT; i++) {
+            Vector2 EDGE = JVector2_Subtract(POLYGON -> Vertices[(i + 1) % COUNT], POLYGON -> Vertices[i]);
+            Vector2 NEXT = JVector2_Subtract(POLYGON -> Vertices[(i + 2) % COUNT], POLYGON -> Vertices[(i + 1) % COUNT]);
+
+            if (JVector2_Length(EDGE) == 0.0f || JVector2_Cross(EDGE, NEXT) <= 0.0f) return 0;
+
+            POLYGON -> Normals[i] = JVector2_Normalize((Vector2){EDGE.y, -EDGE.x});
+        }
+
+        return 1;
+    }
+
+    JubiPolygon2D JPolygon2D_Box(Vector2 HalfSize) {
+        JubiPolygon2D POLYGON;
+
+        POLYGON.Count = 4;
+
+        POLYGON.Vertices[0] = (Vector2){-HalfSize.x, -HalfSize.y};
+        POLYGON.Vertices[1] = (Vector2){HalfSize.x, -HalfSize.y};
+        POLYGON.Vertices[2] = (Vector2){HalfSize.x, HalfSize.y};
+        POLYGON.Vertices[3] = (Vector2){-HalfSize.x, HalfSize.y};
+
+        POLYGON.Normals[0] = (Vector2){0, -1};
+        POLYGON.Normals[1] = (Vector2){1, 0};
+        POLYGON.Normals[2] = (Vector2){0, 1};
+        POLYGON.Normals[3] = (Vector2){-1, 0};
+
+        return POLYGON;
+    }
+
+    // Largest separation of B from any of A's edges, writing the edge it was found on
+    static float Jubi__PolygonSeparation2D(const JubiPolygon2D *A, Vector2 POSITION_A, const JubiPolygon2D *B, Vector2 POSITION_B, int *EDGE) {
+        Vector2 OFFSET = JVector2_Subtract(POSITION_B, POSITION_A);
+        float BEST = -INFINITY;
+
+        for (int i=0; i < A -> Count; i++) {
+            float DEEPEST = INFINITY;
+
+            for (int j=0; j < B -> Count; j++) {
+                float DISTANCE = JVector2_Dot(A -> Normals[i], JVector2_Subtract(JVector2_Add(B -> Vertices[j], OFFSET), A -> Vertices[i]));
+
+                if (DISTANCE < DEEPEST) DEEPEST = DISTANCE;
+            }
+
+            if (DEEPEST > BEST) {
+                BEST = DEEPEST;
+                *EDGE = i;
+            }
+        }
+
+        return BEST;
+    }
+
+    // SAT, with the reference face taken from whichever polygon separates least, then the other polygon's incident edge clipped to the reference face's sides for up to 2 contact points.
+    int JCollision_PolygonvsPolygon(const JubiPolygon2D *A, Vector2 POSITION_A, const JubiPolygon2D *B, Vector2 POSITION_B, JubiManifold2D *MANIFOLD) {
+        int EDGE_A = 0, EDGE_B = 0;
+
+        float SEPARATION_A = Jubi__PolygonSeparation2D(A, POSITION_A, B, POSITION_B, &EDGE_A);
+        if (SEPARATION_A >= 0.0f) return 0;
+
+        float SEPARATION_B = Jubi__PolygonSeparation2D(B, POSITION_B, A, POSITION_A, &EDGE_B);
+        if (SEPARATION_B >= 0.0f) return 0;
+
+        if (MANIFOLD == NULL) return 1;
+
+        // Prefer A's face when they're about equal, so the choice doesn't flicker between frames
+        int FLIP = SEPARATION_B > SEPARATION_A + 0.0005f;
+
+        const JubiPolygon2D *REFERENCE = FLIP ? B : A;
+        const JubiPolygon2D *INCIDENT = FLIP ? A : B;
+        Vector2 REFERENCE_POSITION = FLIP ? POSITION_B : POSITION_A;
+        Vector2 INCIDENT_POSITION = FLIP ? POSITION_A : POSITION_B;
+        int EDGE = FLIP ? EDGE_B : EDGE_A;
+
+        Vector2 NORMAL = REFERENCE -> Normals[EDGE];
+
+        // The incident edge is the one facing most against the reference normal
+        int INCIDENT_EDGE = 0;
+        float LOWEST = INFINITY;
+
+        for (int i=0; i < INCIDENT -> Count; i++) {
+            float DOT = JVector2_Dot(NORMAL, INCIDENT -> Normals[i]);
+
+            if (DOT < LOWEST) {
+                LOWEST = DOT;
+                INCIDENT_EDGE = i;
+            }
+        }
+
+        Vector2 CLIP[2] = {
+            JVector2_Add(INCIDENT -> Vertices[INCIDENT_EDGE], INCIDENT_POSITION),
+            JVector2_Add(INCIDENT -> Vertices[(INCIDENT_EDGE + 1) % INCIDENT -> Count], INCIDENT_POSITION)
+        };
+
+        Vector2 REFERENCE_1 = JVector2_Add(REFERENCE -> Vertices[EDGE], REFERENCE_POSITION);
+        Vector2 REFERENCE_2 = JVector2_Add(REFERENCE -> Vertices[(EDGE + 1) % REFERENCE -> Count], REFERENCE_POSITION);
+        Vector2 TANGENT = JVector2_Normalize(JVector2_Subtract(REFERENCE_2, REFERENCE_1));
+
+        // Side planes at either end of the reference edge, facing outwards
+        Vector2 SIDE_NORMALS[2] = {JVector2_Scale(TANGENT, -1.0f), TANGENT};
+        float SIDES[2] = {-JVector2_Dot(TANGENT, REFERENCE_1), JVector2_Dot(TANGENT, REFERENCE_2)};
+
+        for (int Side = 0; Side < 2; Side++) {
+            float D0 = JVector2_Dot(SIDE_NORMALS[Side], CLIP[0]) - SIDES[Side];
+            float D1 = JVector2_Dot(SIDE_NORMALS[Side], CLIP[1]) - SIDES[Side];
+
+            if (D0 > 0.0f && D1 > 0.0f) return 0;
+
+            if (D0 > 0.0f) CLIP[0] = JVector2_Add(CLIP[0], JVector2_Scale(JVector2_Subtract(CLIP[1], CLIP[0]), D0 / (D0 - D1)));
+            else if (D1 > 0.0f) CLIP[1] = JVector2_Add(CLIP[1], JVector2_Scale(JVector2_Subtract(CLIP[0], CLIP[1]), D1 / (D1 - D0)));
+        }
+
+        MANIFOLD -> PointCount = 0;
+        MANIFOLD -> Depth = 0.0f;
+
+        for (int i=0; i < 2; i++) {
+            float SEPARATION = JVector2_Dot(NORMAL, JVector2_Subtract(CLIP[i], REFERENCE_1));
+            if (SEPARATION > 0.0f) continue;
+
+            MANIFOLD -> Points[MANIFOLD -> PointCount++] = CLIP[i];
+            if (-SEPARATION > MANIFOLD -> Depth) MANIFOLD -> Depth = -SEPARATION;
+        }
+
+        if (MANIFOLD -> PointCount == 0) return 0;
+
+        MANIFOLD -> Normal = FLIP ? JVector2_Scale(NORMAL, -1.0f) : NORMAL;
+
+        return 1;
+    }
+
+    int JCollision_PolygonvsCircle(const JubiPolygon2D *A, Vector2 POSITION_A, Circle2D B, JubiManifold2D *MANIFOLD) {
+        Vector2 CENTER = JVector2_Subtract(B.Center, POSITION_A); // In A's local space
+
+        int EDGE = 0;
+        float SEPARATION = -INFINITY;
+
+        for (int i=0; i < A -> Count; i++) {
+            float DISTANCE = JVector2_Dot(A -> Normals[i], JVector2_Subtract(CENTER, A -> Vertices[i]));
+
+            if (DISTANCE > B.Radius) return 0;
+
+            if (DISTANCE > SEPARATION) {
+                SEPARATION = DISTANCE;
+                EDGE = i;
+            }
+        }
+
+        Vector2 V1 = A -> Vertices[EDGE];
+        Vector2 V2 = A -> Vertices[(EDGE + 1) % A -> Count];
+
+        Vector2 NORMAL = A -> Normals[EDGE];
+        float DEPTH = B.Radius - SEPARATION;
+
+        // Center is outside the face, it may be closest to one of the edge's corners instead
+        if (SEPARATION > 0.0f) {
+            Vector2 CORNER = {0, 0};
+            int HAS_CORNER = 0;
+
+            if (JVector2_Dot(JVector2_Subtract(CENTER, V1), JVector2_Subtract(V2, V1)) <= 0.0f) {
+                CORNER = V1;
+                HAS_CORNER = 1;
+            } else if (JVector2_Dot(JVector2_Subtract(CENTER, V2), JVector2_Subtract(V1, V2)) <= 0.0f) {
+                CORNER = V2;
+                HAS_CORNER = 1;
+            }
+
+            if (HAS_CORNER) {
+                float DISTANCE = JVector2_Distance(CORNER, CENTER);
+                if (DISTANCE >= B.Radius || DISTANCE == 0.0f) return 0;
+
+                NORMAL = JVector2_Direction(CORNER, CENTER);
+                DEPTH = B.Radius - DISTANCE;
+            }
+        }
+
+        if (MANIFOLD) {
+            MANIFOLD -> Normal = NORMAL;
+            MANIFOLD -> Depth = DEPTH;
+            MANIFOLD -> Points[0] = JVector2_Subtract(B.Center, JVector2_Scale(NORMAL, B.Radius));
+            MANIFOLD -> PointCount = 1;
+        }
+
+        return 1;
+    }
+
+    // Exact time of impact for a translating convex polygon: the slab test from JCollision_SweepAABBvsAABB, run over every edge normal of both polygons.
+    int JCollision_SweepPolygonvsPolygon(const JubiPolygon2D *A, Vector2 POSITION_A, Vector2 DISPLACEMENT, const JubiPolygon2D *B, Vector2 POSITION_B, float *TOI, Vector2 *NORMAL) {
+        float ENTER = -INFINITY, EXIT = INFINITY;
+        Vector2 HIT_NORMAL = {0, 0};
+
+        for (int Axis = 0; Axis < A -> Count + B -> Count; Axis++) {
+            Vector2 N = Axis < A -> Count ? A -> Normals[Axis] : B -> Normals[Axis - A -> Count];
+
+            float A_MIN = INFINITY, A_MAX = -INFINITY, B_MIN = INFINITY, B_MAX = -INFINITY;
+
+            for (int i=0; i < A -> Count; i++) {
+                float PROJECTION = JVector2_Dot(N, JVector2_Add(A -> Vertices[i], POSITION_A));
+
+                A_MIN = fminf(A_MIN, PROJECTION);
+                A_MAX = fmaxf(A_MAX, PROJECTION);
+            }
+
+            for (int i=0; i < B -> Count; i++) {
+                float PROJECTION = JVector2_Dot(N, JVector2_Add(B -> Vertices[i], POSITION_B));
+
+                B_MIN = fminf(B_MIN, PROJECTION);
+                B_MAX = fmaxf(B_MAX, PROJECTION);
+            }
+
+            float MOTION = JVector2_Dot(N, DISPLACEMENT);
+
+            if (MOTION == 0.0f) {
+                if (A_MAX <= B_MIN || A_MIN >= B_MAX) return 0;
+
+                continue;
+            }
+
+            float AXIS_ENTER = MOTION > 0.0f ? (B_MIN - A_MAX) / MOTION : (B_MAX - A_MIN) / MOTION;
+            float AXIS_EXIT = MOTION > 0.0f ? (B_MAX - A_MIN) / MOTION : (B_MIN - A_MAX) / MOTION;
+
+            if (AXIS_ENTER > ENTER) {
+                ENTER = AXIS_ENTER;
+                HIT_NORMAL = MOTION > 0.0f ? JVector2_Scale(N, -1.0f) : N;
+            }
+
+            if (AXIS_EXIT < EXIT) EXIT = AXIS_EXIT;
+        }
+
+        if (ENTER > EXIT || ENTER < 0.0f || ENTER > 1.0f) return 0;
+
+        if (TOI) *TOI = ENTER;
+        if (NORMAL) *NORMAL = HIT_NORMAL;
+
+        return 1;
+    }
+
+    // The body's shape as a polygon, boxes (& circles, by their bounds) are built into SCRATCH
+    static const JubiPolygon2D *Jubi__BodyPolygon2D(const Body2D *BODY, JubiPolygon2D *SCRATCH) {
+        if (BODY -> Shape == SHAPE_POLYGON && BODY -> WORLD && BODY -> ShapeId >= 0)
+            return &BODY -> WORLD -> Polygons[BODY -> WORLD -> Shapes[BODY -> ShapeId].PolygonId];
+
+        *SCRATCH = JPolygon2D_Box((Vector2){BODY -> _Size.x * .5f, BODY -> _Size.y * .5f});
+
+        return SCRATCH;
+    }
+
+    static int Jubi__CollidePolygonBodies2D(Body2D *A, Body2D *B, JubiManifold2D *MANIFOLD) {
+        JubiPolygon2D SCRATCH_A, SCRATCH_B;
+
+        if (B -> Shape == SHAPE_CIRCLE)
+            return JCollision_PolygonvsCircle(Jubi__BodyPolygon2D(A, &SCRATCH_A), A -> Position, (Circle2D){B -> Position, B -> _Size.x * .5f}, MANIFOLD);
+
+        if (A -> Shape == SHAPE_CIRCLE) {
+            if (!JCollision_PolygonvsCircle(Jubi__BodyPolygon2D(B, &SCRATCH_B), B -> Position, (Circle2D){A -> Position, A -> _Size.x * .5f}, MANIFOLD)) return 0;
+
+            MANIFOLD -> Normal = JVector2_Scale(MANIFOLD -> Normal, -1.0f);
+
+            return 1;
+        }
+
+        return JCollision_PolygonvsPolygon(Jubi__BodyPolygon2D(A, &SCRATCH_A), A -> Position, Jubi__BodyPolygon2D(B, &SCRATCH_B), B -> Position, MANIFOLD);
+    }
+
+    int JCollision_ResolveCirclevsCircle(Body2D *A, Body2D *B) {
+        A -> Velocity = (Vector2){0, 0};
+        B -> Velocity = (Vector2){0, 0};
+    }
+
+    int JCollision_ResolveAABBvsCircle(Body2D *A, Body2D *B) {
+        A -> Velocity = (Vector2){0, 0};
+        B -> Velocity = (Vector2){0, 0};
+    }
+
+
+    // 3D World
+
+    JubiWorld3D Jubi_CreateWorld3D() {
+        JubiWorld3D WORLD;
+
+        WORLD.BodyCount = 0;
+        WORLD.Gravity = (Vector3){0, GRAVITY, 0, 0};
+        WORLD.SolverIterations = JUBI_SOLVER_ITERATIONS_3D;
+        WORLD.StepCount = 0;
+        WORLD.Destroyed = 0;
+
+        Jubi__ResetHandles3D(&WORLD);
+
+        WORLD.Scratch = (JubiArena){0};
+
+        WORLD._SortedCount = 0;
+        WORLD._BroadphaseDirty = 1;
+        WORLD._MaxWidthX = 0.0f;
+
+        return WORLD;
+    }
+
+    void Jubi_ClearWorld3D(JubiWorld3D *WORLD) {
+        if (WORLD == NULL) return;
+        if (WORLD -> Destroyed) return;
+
+        WORLD -> BodyCount = 0;
+        WORLD -> _SortedCount = 0;
+        WORLD -> _BroadphaseDirty = 1;
+
+        Jubi__ResetHandles3D(WORLD);
+    }
+
+    void Jubi_DestroyWorld3D(JubiWorld3D *WORLD) {
+        if (WORLD == NULL) return;
+        if (WORLD -> Destroyed) return;
+
+        WORLD -> BodyCount = 0;
+        WORLD -> _SortedCount = 0;
+        WORLD -> Destroyed = 1;
+
+        Jubi__FreeArena(&WORLD -> Scratch);
+    }
+
+    // Same codes as Jubi_IsWorldValid, so Jubi_GetWorldError works for both
+    int Jubi_IsWorldValid3D(const JubiWorld3D *WORLD) {
+        if (WORLD == NULL) return -1;
+        if (WORLD -> BodyCount < 0) return -2;
+        if (WORLD -> BodyCount > JUBI_MAX_BODIES) return -3;
+        if (WORLD -> Destroyed) return -4;
+
+        return 1;
+    }
+
+    void Jubi_StepWorld3D(JubiWorld3D *WORLD, float DeltaTime) {
+        Jubi__IncrementErrorTick();
+
+        if (Jubi_IsWorldValid3D(WORLD) != 1) {
+            Jubi__SetError(Jubi_GetWorldError(Jubi_IsWorldValid3D(WORLD)), __func__);
+
+            return;
+        }
+
+        Jubi__ResetArena(&WORLD -> Scratch);
+
+        Jubi__IntegrateBodies3D(WORLD, DeltaTime);
+
+        WORLD -> _BroadphaseDirty = 1;
+        Jubi__UpdateBroadphase3D(WORLD);
+
+        // Gather every overlapping pair first, like the 2D step, so resolving one pair can't change which pairs the sweep finds
+        int PAIR_CAPACITY = WORLD -> BodyCount * 4 + 4;
+        int PAIR_COUNT = 0;
+
+        JubiPair2D *PAIRS = (JubiPair2D *)Jubi__ArenaAlloc(&WORLD -> Scratch, sizeof(JubiPair2D) * PAIR_CAPACITY);
+        if (PAIRS == NULL) PAIR_CAPACITY = 0;
+
+        const float *PY = WORLD -> PositionY, *PZ = WORLD -> PositionZ, *HY = WORLD -> HalfY, *HZ = WORLD -> HalfZ;
+
+        for (int i=0; i < WORLD -> _SortedCount; i++) {
+            int A = WORLD -> _SortedBodies[i];
+
+            for (int j = i + 1; j < WORLD -> _SortedCount; j++) {
+                int B = WORLD -> _SortedBodies[j];
+
+                if (WORLD -> _MinX[B] >= WORLD -> _MaxX[A]) break;
+
+                if (WORLD -> _Moves[A] + WORLD -> _Moves[B] == 0.0f) continue;
+                if (fabsf(PY[B] - PY[A]) >= HY[A] + HY[B] || fabsf(PZ[B] - PZ[A]) >= HZ[A] + HZ[B]) continue;
+
+                if (PAIR_COUNT == PAIR_CAPACITY) {
+                    int CAPACITY = PAIR_CAPACITY > 0 ? PAIR_CAPACITY * 2 : 64;
+                    JubiPair2D *GROWN = (JubiPair2D *)Jubi__ArenaAlloc(&WORLD -> Scratch, sizeof(JubiPair2D) * CAPACITY);
+
+                    // Out of memory, only the pairs already found are resolved this step
+                    if (GROWN == NULL) continue;
+
+                    for (int p=0; p < PAIR_COUNT; p++) GROWN[p] = PAIRS[p];
+
+                    PAIRS = GROWN;
+                    PAIR_CAPACITY = CAPACITY;
+                }
+
+                PAIRS[PAIR_COUNT].A = A;
+                PAIRS[PAIR_COUNT].B = B;
+                PAIR_COUNT++;
+            }
+        }
+
+        for (int Iteration = 0; Iteration < WORLD -> SolverIterations; Iteration++) {
+            for (int i=0; i < PAIR_COUNT; i++)
+                Jubi__ResolvePair3D(WORLD, PAIRS[i].A, PAIRS[i].B);
+        }
+
+        WORLD -> _BroadphaseDirty = 1;
+        WORLD -> StepCount++;
+    }
+
+    // Returns the number of bodies overlapping AREA, the handles of the first MAX are written to OUT
+    int Jubi_QueryAABB3D(JubiWorld3D *WORLD, AABB3D AREA, int *OUT, int MAX) {
+        Jubi__IncrementErrorTick();
+
+        if (Jubi_IsWorldValid3D(WORLD) != 1) {
+            Jubi__SetError(Jubi_GetWorldError(Jubi_IsWorldValid3D(WORLD)), __func__);
+
+            return -1;
+        } else if (OUT == NULL && MAX > 0) {
+            Jubi__SetError(JUBI_ERROR_NULL_VALUE, __func__);
+
+            return -1;
+        }
+
+        Jubi__UpdateBroadphase3D(WORLD);
+
+        int *SORTED = WORLD -> _SortedBodies;
+        int LOW = 0, HIGH = WORLD -> _SortedCount;
+
+        float START = AREA.Min.x - WORLD -> _MaxWidthX;
+
+        while (LOW < HIGH) {
+            int MIDDLE = (LOW + HIGH) / 2;
+
+            if (WORLD -> _MinX[SORTED[MIDDLE]] < START) LOW = MIDDLE + 1;
+            else HIGH = MIDDLE;
+        }
+
+        int COUNT = 0;
+
+        for (int i = LOW; i < WORLD -> _SortedCount; i++) {
+            int INDEX = SORTED[i];
+
+            if (WORLD -> _MinX[INDEX] >= AREA.Max.x) break;
+            if (WORLD -> _MaxX[INDEX] <= AREA.Min.x) continue;
+
+            if (WORLD -> PositionY[INDEX] + WORLD -> HalfY[INDEX] <= AREA.Min.y || WORLD -> PositionY[INDEX] - WORLD -> HalfY[INDEX] >= AREA.Max.y) continue;
+            if (WORLD -> PositionZ[INDEX] + WORLD -> HalfZ[INDEX] <= AREA.Min.z || WORLD -> PositionZ[INDEX] - WORLD -> HalfZ[INDEX] >= AREA.Max.z) continue;
+
+            if (COUNT < MAX) OUT[COUNT] = WORLD -> Handle[INDEX];
+            COUNT++;
+        }
+
+        return COUNT;
     }
 
-    Vector2 JVector2_Normalize(Vector2 A) {
-        float LENGTH = sqrt(A.x * A.x + A.y * A.y);
+    // Bodies are returned by handle, -1 when the world is full or invalid
 
-        A.x /= LENGTH;
-        A.y /= LENGTH;
+    int JBody3D_CreateBox(JubiWorld3D *WORLD, Vector3 Position, Vector3 Size, BodyType2D Type, float Mass) {
+        Jubi__IncrementErrorTick();
 
-        return A;
+        return Jubi__CreateBody3D(WORLD, Position, (Vector3){Size.x * .5f, Size.y * .5f, Size.z * .5f, 0}, SHAPE3D_BOX, Type, Mass, __func__);
     }
 
-    float JVector2_Distance(Vector2 A, Vector2 B) {
-        float RESULTX = B.x - A.x;
-        float RESULTY = B.y - A.y;
+    int JBody3D_CreateSphere(JubiWorld3D *WORLD, Vector3 Position, float Radius, BodyType2D Type, float Mass) {
+        Jubi__IncrementErrorTick();
 
-        return sqrt(RESULTX * RESULTX + RESULTY * RESULTY);
+        return Jubi__CreateBody3D(WORLD, Position, (Vector3){Radius, Radius, Radius, 0}, SHAPE3D_SPHERE, Type, Mass, __func__);
     }
 
-    Vector2 JVector2_Direction(Vector2 A, Vector2 B) {
-        Vector2 RESULT;
+    // The last body moves into the gap, so only its index changes
+    int JBody3D_Destroy(JubiWorld3D *WORLD, int HANDLE) {
+        Jubi__IncrementErrorTick();
 
-        RESULT.x = B.x - A.x;
-        RESULT.y = B.y - A.y;
+        if (Jubi_IsWorldValid3D(WORLD) != 1) {
+            Jubi__SetError(Jubi_GetWorldError(Jubi_IsWorldValid3D(WORLD)), __func__);
 
-        float LENGTH = sqrt(RESULT.x * RESULT.x + RESULT.y * RESULT.y);
+            return -1;
+        }
 
-        if (LENGTH == 0)
-            return (Vector2){0, 0};
+        int INDEX = Jubi_GetBodyIndex3D(WORLD, HANDLE);
 
-        RESULT.x /= LENGTH;
-        RESULT.y /= LENGTH;
+        if (INDEX < 0) {
+            Jubi__SetError(JUBI_ERROR_BODY_NOT_IN_WORLD, __func__);
 
-        return RESULT;
-    }
+            return -1;
+        }
 
-    Vector2 JVector_Project(Vector2 A, Vector2 B) {
-        Vector2 RESULT;
+        int LAST = --WORLD -> BodyCount;
 
-        float DOT_PRODUCT = JVector2_Dot(A, B);
-        float B_LENGTH_SQUARED = JVector2_Dot(B, B);
+        // Keep the sweep order rather than sorting from scratch, with LAST renamed to INDEX
+        if (WORLD -> _SortedCount == LAST + 1) {
+            int WRITE = 0;
 
-        if (B_LENGTH_SQUARED == 0)
-            return (Vector2){0, 0};
+            for (int i=0; i < WORLD -> _SortedCount; i++) {
+                int SORTED = WORLD -> _SortedBodies[i];
+                if (SORTED == INDEX) continue;
 
-        float SCALAR = DOT_PRODUCT / B_LENGTH_SQUARED;
+                WORLD -> _SortedBodies[WRITE++] = SORTED == LAST ? INDEX : SORTED;
+            }
 
-        RESULT.x = B.x * SCALAR;
-        RESULT.y = B.y * SCALAR;
+            WORLD -> _SortedCount = WRITE;
+        } else {
+            WORLD -> _SortedCount = 0;
+        }
 
-        return RESULT;
+        WORLD -> _HandleToIndex[HANDLE] = -1;
+        WORLD -> _FreeHandles[WORLD -> _FreeHandleCount++] = HANDLE;
+
+        if (INDEX != LAST) {
+            WORLD -> PositionX[INDEX] = WORLD -> PositionX[LAST];
+            WORLD -> PositionY[INDEX] = WORLD -> PositionY[LAST];
+            WORLD -> PositionZ[INDEX] = WORLD -> PositionZ[LAST];
+            WORLD -> VelocityX[INDEX] = WORLD -> VelocityX[LAST];
+            WORLD -> VelocityY[INDEX] = WORLD -> VelocityY[LAST];
+            WORLD -> VelocityZ[INDEX] = WORLD -> VelocityZ[LAST];
+            WORLD -> ForceX[INDEX] = WORLD -> ForceX[LAST];
+            WORLD -> ForceY[INDEX] = WORLD -> ForceY[LAST];
+            WORLD -> ForceZ[INDEX] = WORLD -> ForceZ[LAST];
+            WORLD -> HalfX[INDEX] = WORLD -> HalfX[LAST];
+            WORLD -> HalfY[INDEX] = WORLD -> HalfY[LAST];
+            WORLD -> HalfZ[INDEX] = WORLD -> HalfZ[LAST];
+            WORLD -> Mass[INDEX] = WORLD -> Mass[LAST];
+            WORLD -> InvMass[INDEX] = WORLD -> InvMass[LAST];
+            WORLD -> Restitution[INDEX] = WORLD -> Restitution[LAST];
+            WORLD -> _Moves[INDEX] = WORLD -> _Moves[LAST];
+            WORLD -> Shape[INDEX] = WORLD -> Shape[LAST];
+            WORLD -> Type[INDEX] = WORLD -> Type[LAST];
+            WORLD -> Handle[INDEX] = WORLD -> Handle[LAST];
+            WORLD -> UserData[INDEX] = WORLD -> UserData[LAST];
+            WORLD -> _MinX[INDEX] = WORLD -> _MinX[LAST];
+            WORLD -> _MaxX[INDEX] = WORLD -> _MaxX[LAST];
+
+            WORLD -> _HandleToIndex[WORLD -> Handle[INDEX]] = INDEX;
+        }
+
+        return 1;
     }
 
-    Vector2 JVector2_Reflect(Vector2 A, Vector2 NORMAL) {
-        Vector2 RESULT;
-        
-        float DOT_PRODUCT = JVector2_Dot(A, NORMAL);
+    // -1 for handles that aren't in the world
+    int Jubi_GetBodyIndex3D(const JubiWorld3D *WORLD, int HANDLE) {
+        if (WORLD == NULL || HANDLE < 0 || HANDLE >= JUBI_MAX_BODIES) return -1;
 
-        RESULT.x = A.x - 2 * DOT_PRODUCT * NORMAL.x;
-        RESULT.y = A.y - 2 * DOT_PRODUCT * NORMAL.y;
+        return WORLD -> _HandleToIndex[HANDLE];
+    }
 
-        return RESULT;
+    Vector3 JBody3D_GetPosition(const JubiWorld3D *WORLD, int HANDLE) {
+        int INDEX = Jubi_GetBodyIndex3D(WORLD, HANDLE);
+        if (INDEX < 0) return (Vector3){0, 0, 0, 0};
+
+        return (Vector3){WORLD -> PositionX[INDEX], WORLD -> PositionY[INDEX], WORLD -> PositionZ[INDEX], 0};
     }
 
-    Vector2 JVector2_Perpendicular(Vector2 A) {
-        Vector2 RESULT;
-        
-        RESULT.x = -A.y;
-        RESULT.y = A.x;
+    Vector3 JBody3D_GetVelocity(const JubiWorld3D *WORLD, int HANDLE) {
+        int INDEX = Jubi_GetBodyIndex3D(WORLD, HANDLE);
+        if (INDEX < 0) return (Vector3){0, 0, 0, 0};
 
-        return RESULT;
+        return (Vector3){WORLD -> VelocityX[INDEX], WORLD -> VelocityY[INDEX], WORLD -> VelocityZ[INDEX], 0};
     }
-    
-    float JClamp(float Value, float MIN, float MAX) {
-        if (Value < MIN) return MIN;
-        if (Value > MAX) return MAX;
 
-        return Value;
+    void JBody3D_SetPosition(JubiWorld3D *WORLD, int HANDLE, Vector3 POSITION) {
+        int INDEX = Jubi_GetBodyIndex3D(WORLD, HANDLE);
+        if (INDEX < 0) return;
+
+        WORLD -> PositionX[INDEX] = POSITION.x;
+        WORLD -> PositionY[INDEX] = POSITION.y;
+        WORLD -> PositionZ[INDEX] = POSITION.z;
+
+        WORLD -> _BroadphaseDirty = 1;
     }
 
-    // Global Initializers
+    void JBody3D_SetVelocity(JubiWorld3D *WORLD, int HANDLE, Vector3 VELOCITY) {
+        int INDEX = Jubi_GetBodyIndex3D(WORLD, HANDLE);
+        if (INDEX < 0) return;
 
-    // Collision Initializers
+        WORLD -> VelocityX[INDEX] = VELOCITY.x;
+        WORLD -> VelocityY[INDEX] = VELOCITY.y;
+        WORLD -> VelocityZ[INDEX] = VELOCITY.z;
+    }
 
-    AABB JInitialize_AABB(Vector2 Position, Vector2 Size) {
-        Vector2 Half = {Size.x * .5f, Size.y * .5f};
+    void JBody3D_ApplyForce(JubiWorld3D *WORLD, int HANDLE, Vector3 FORCE) {
+        int INDEX = Jubi_GetBodyIndex3D(WORLD, HANDLE);
+        if (INDEX < 0) return;
 
-        AABB Box;
+        WORLD -> ForceX[INDEX] += FORCE.x;
+        WORLD -> ForceY[INDEX] += FORCE.y;
+        WORLD -> ForceZ[INDEX] += FORCE.z;
+    }
 
-        Box.Min.x = Position.x - Half.x;
-        Box.Min.y = Position.y - Half.y;
-        Box.Max.x = Position.x + Half.x;
-        Box.Max.y = Position.y + Half.y;
+    void JBody3D_ApplyImpulse(JubiWorld3D *WORLD, int HANDLE, Vector3 IMPULSE) {
+        int INDEX = Jubi_GetBodyIndex3D(WORLD, HANDLE);
+        if (INDEX < 0 || WORLD -> _Moves[INDEX] == 0.0f) return;
 
-        return Box;
+        WORLD -> VelocityX[INDEX] += IMPULSE.x * WORLD -> InvMass[INDEX];
+        WORLD -> VelocityY[INDEX] += IMPULSE.y * WORLD -> InvMass[INDEX];
+        WORLD -> VelocityZ[INDEX] += IMPULSE.z * WORLD -> InvMass[INDEX];
     }
 
-    // Vector2 Initializers
+    // Vector3 Math
 
-    Body2D JBody2D_Init(Vector2 Position, Vector2 Size, Shape2D Shape, BodyType2D Type, float Mass) {
-        Body2D BODY;
+    Vector3 JVector3(float x, float y, float z) {
+        return (Vector3){x, y, z, 0};
+    }
 
-        BODY.Position = Position;
-        BODY.Velocity = (Vector2){0, 0};
-        BODY._Size = Size;
-        BODY.Shape = Shape;
-        BODY.Type = Type;
+    Vector3 JVector3_Add(Vector3 A, Vector3 B) {
+        return (Vector3){A.x + B.x, A.y + B.y, A.z + B.z, 0};
+    }
 
-        BODY.Mass = Mass;
-        BODY.InvMass = (Mass > 0.0f) ? (1.0f / Mass) : 0.0f;
-        BODY.Restitution = 0.0f;
-        BODY.Friction = 0.0f;
+    Vector3 JVector3_Subtract(Vector3 A, Vector3 B) {
+        return (Vector3){A.x - B.x, A.y - B.y, A.z - B.z, 0};
+    }
 
-        BODY.ShapeData._AABB = JInitialize_AABB(Position, Size); // tbd?
-        BODY.Bounds = JInitialize_AABB(Position, Size);
+    Vector3 JVector3_Scale(Vector3 A, float Scalar) {
+        return (Vector3){A.x * Scalar, A.y * Scalar, A.z * Scalar, 0};
+    }
 
-        BODY.Index = -1;
-        BODY.WORLD = NULL;
+    float JVector3_Dot(Vector3 A, Vector3 B) {
+        return A.x * B.x + A.y * B.y + A.z * B.z;
+    }
 
-        return BODY;
+    float JVector3_Length(Vector3 A) {
+        return sqrtf(JVector3_Dot(A, A));
     }
 
-    Body2D *JBody2D_CreateBox(JubiWorld2D *WORLD, Vector2 Position, Vector2 Size, BodyType2D Type, float Mass) {
-        Jubi__IncrementErrorTick();
-        
-        Body2D BODY = JBody2D_Init(Position, Size, SHAPE_BOX, Type, Mass);
+    static int Jubi__CreateBody3D(JubiWorld3D *WORLD, Vector3 Position, Vector3 Half, Shape3D Shape, BodyType2D Type, float Mass, const char *FUNCTION) {
+        if (Jubi_IsWorldValid3D(WORLD) != 1) {
+            Jubi__SetError(Jubi_GetWorldError(Jubi_IsWorldValid3D(WORLD)), FUNCTION);
 
-        if (WORLD == NULL) {
-            Jubi__SetError(JUBI_ERROR_NULL_WORLD, __func__);
+            return JUBI_INVALID_HANDLE;
+        } else if (WORLD -> BodyCount >= JUBI_MAX_BODIES) {
+            Jubi__SetError(JUBI_ERROR_WORLD_FULL, FUNCTION);
 
-            return NULL;
-        }
-        
-        if (Jubi_IsWorldValid(WORLD) != 1) {
-            Jubi__SetError(Jubi_GetWorldError(Jubi_IsWorldValid(WORLD)), __func__);
+            return JUBI_INVALID_HANDLE;
+        } else if (Half.x <= 0.0f || Half.y <= 0.0f || Half.z <= 0.0f || Mass < 0.0f) {
+            Jubi__SetError(JUBI_ERROR_INVALID_VALUE, FUNCTION);
 
-            return NULL;
+            return JUBI_INVALID_HANDLE;
         }
 
-        int INDEX = Jubi_AddBodyToWorld(WORLD, &BODY);
-        if (INDEX < 0) return NULL;  
+        int INDEX = WORLD -> BodyCount++;
+        int HANDLE = WORLD -> _FreeHandles[--WORLD -> _FreeHandleCount];
+
+        int MOVES = Type == BODY_DYNAMIC && Mass > 0.0f;
+
+        WORLD -> PositionX[INDEX] = Position.x;
+        WORLD -> PositionY[INDEX] = Position.y;
+        WORLD -> PositionZ[INDEX] = Position.z;
+        WORLD -> VelocityX[INDEX] = WORLD -> VelocityY[INDEX] = WORLD -> VelocityZ[INDEX] = 0.0f;
+        WORLD -> ForceX[INDEX] = WORLD -> ForceY[INDEX] = WORLD -> ForceZ[INDEX] = 0.0f;
+        WORLD -> HalfX[INDEX] = Half.x;
+        WORLD -> HalfY[INDEX] = Half.y;
+        WORLD -> HalfZ[INDEX] = Half.z;
+        WORLD -> Mass[INDEX] = Mass;
+        WORLD -> InvMass[INDEX] = MOVES ? 1.0f / Mass : 0.0f;
+        WORLD -> Restitution[INDEX] = 0.0f;
+        WORLD -> _Moves[INDEX] = MOVES ? 1.0f : 0.0f;
+        WORLD -> Shape[INDEX] = (JUBI_UINT8)Shape;
+        WORLD -> Type[INDEX] = (JUBI_UINT8)Type;
+        WORLD -> Handle[INDEX] = HANDLE;
+        WORLD -> UserData[INDEX] = NULL;
+
+        WORLD -> _HandleToIndex[HANDLE] = INDEX;
+        WORLD -> _BroadphaseDirty = 1;
+
+        return HANDLE;
+    }
 
-        WORLD -> Bodies[INDEX].Index = INDEX;
-        WORLD -> Bodies[INDEX].WORLD = WORLD;
+    static void Jubi__ResetHandles3D(JubiWorld3D *WORLD) {
+        for (int i=0; i < JUBI_MAX_BODIES; i++) {
+            WORLD -> _HandleToIndex[i] = -1;
+            WORLD -> _FreeHandles[i] = JUBI_MAX_BODIES - 1 - i;
+        }
 
-        return &WORLD -> Bodies[INDEX];
+        WORLD -> _FreeHandleCount = JUBI_MAX_BODIES;
     }
 
-    Body2D *JBody2D_CreateCircle(JubiWorld2D *WORLD, Vector2 Position, Vector2 Size, BodyType2D Type, float Mass) {
-        Jubi__IncrementErrorTick();
-        
-        Body2D BODY = JBody2D_Init(Position, Size, SHAPE_CIRCLE, Type, Mass);
+    // One axis of every body, V = (V + (F / m + g) dt) * drag, P += V dt. _Moves zeroes static bodies without a branch, & the plain C tail does the exact same operations so results don't depend on the body count.
+    static void Jubi__IntegrateAxis3D(float *P, float *V, float *F, const float *INV, const float *MOVES, float G, float DT, float DRAG, int COUNT) {
+        int i = 0;
 
-        if (WORLD == NULL) {
-            Jubi__SetError(JUBI_ERROR_NULL_WORLD, __func__);
+        #if defined(JUBI_SIMD_SSE)
+            __m128 G4 = _mm_set1_ps(G), DT4 = _mm_set1_ps(DT), DRAG4 = _mm_set1_ps(DRAG), ZERO = _mm_setzero_ps();
 
-            return NULL;
-        }
-        
-        if (Jubi_IsWorldValid(WORLD) != 1) {
-            Jubi__SetError(Jubi_GetWorldError(Jubi_IsWorldValid(WORLD)), __func__);
+            for (; i + 4 <= COUNT; i += 4) {
+                __m128 ACCELERATION = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(&F[i]), _mm_loadu_ps(&INV[i])), G4);
+                __m128 V4 = _mm_mul_ps(_mm_add_ps(_mm_loadu_ps(&V[i]), _mm_mul_ps(ACCELERATION, DT4)), _mm_mul_ps(_mm_loadu_ps(&MOVES[i]), DRAG4));
 
-            return NULL;
-        }
+                _mm_storeu_ps(&V[i], V4);
+                _mm_storeu_ps(&P[i], _mm_add_ps(_mm_loadu_ps(&P[i]), _mm_mul_ps(V4, DT4)));
+                _mm_storeu_ps(&F[i], ZERO);
+            }
+        #elif defined(JUBI_SIMD_NEON)
+            float32x4_t G4 = vdupq_n_f32(G), ZERO = vdupq_n_f32(0.0f);
 
-        int INDEX = Jubi_AddBodyToWorld(WORLD, &BODY);
-        if (INDEX < 0) return NULL;
+            for (; i + 4 <= COUNT; i += 4) {
+                float32x4_t ACCELERATION = vaddq_f32(vmulq_f32(vld1q_f32(&F[i]), vld1q_f32(&INV[i])), G4);
+                float32x4_t V4 = vmulq_f32(vaddq_f32(vld1q_f32(&V[i]), vmulq_n_f32(ACCELERATION, DT)), vmulq_n_f32(vld1q_f32(&MOVES[i]), DRAG));
 
-        WORLD -> Bodies[INDEX].Index = INDEX;
-        WORLD -> Bodies[INDEX].WORLD = WORLD;
+                vst1q_f32(&V[i], V4);
+                vst1q_f32(&P[i], vaddq_f32(vld1q_f32(&P[i]), vmulq_n_f32(V4, DT)));
+                vst1q_f32(&F[i], ZERO);
+            }
+        #endif
 
-        return &WORLD -> Bodies[INDEX];
+        for (; i < COUNT; i++) {
+            V[i] = (V[i] + (F[i] * INV[i] + G) * DT) * (MOVES[i] * DRAG);
+            P[i] += V[i] * DT;
+            F[i] = 0.0f;
+        }
     }
 
-    // Vector2 Physics
-
-    void JBody2D_ApplyForce(Body2D *BODY, Vector2 FORCE) {
-        Jubi__IncrementErrorTick();
-        
-        if (BODY == NULL || BODY -> Type != BODY_DYNAMIC) {
-            Jubi__SetError(JUBI_ERROR_BODY_NOT_VALID, __func__);
-            
-            return;
-        }
+    static void Jubi__IntegrateBodies3D(JubiWorld3D *WORLD, float DeltaTime) {
+        float DRAG = 1.0f - AIR_RESISTANCE;
+        int COUNT = WORLD -> BodyCount;
 
-        BODY -> AccumulatedForce.x += FORCE.x;
-        BODY -> AccumulatedForce.y += FORCE.y;
+        Jubi__IntegrateAxis3D(WORLD -> PositionX, WORLD -> VelocityX, WORLD -> ForceX, WORLD -> InvMass, WORLD -> _Moves, WORLD -> Gravity.x, DeltaTime, DRAG, COUNT);
+        Jubi__IntegrateAxis3D(WORLD -> PositionY, WORLD -> VelocityY, WORLD -> ForceY, WORLD -> InvMass, WORLD -> _Moves, WORLD -> Gravity.y, DeltaTime, DRAG, COUNT);
+        Jubi__IntegrateAxis3D(WORLD -> PositionZ, WORLD -> VelocityZ, WORLD -> ForceZ, WORLD -> InvMass, WORLD -> _Moves, WORLD -> Gravity.z, DeltaTime, DRAG, COUNT);
     }
 
-    void JBody2D_ApplyImpulse(Body2D *BODY, Vector2 IMPULSE) {
-        Jubi__IncrementErrorTick();
-        
-        if (BODY == NULL || BODY -> Type != BODY_DYNAMIC) {
-            Jubi__SetError(JUBI_ERROR_BODY_NOT_VALID, __func__);
-            
-            return;
-        }
+    static void Jubi__UpdateBroadphase3D(JubiWorld3D *WORLD) {
+        if (!WORLD -> _BroadphaseDirty && WORLD -> _SortedCount == WORLD -> BodyCount) return;
 
-        if (BODY -> Mass > 0) {
-            BODY -> Velocity.x += IMPULSE.x * BODY -> InvMass;
-            BODY -> Velocity.y += IMPULSE.y * BODY -> InvMass;
-        }
-    }
+        int COUNT = WORLD -> BodyCount;
+        int *SORTED = WORLD -> _SortedBodies;
 
-    Vector2 JVector2_ApplyGravity(Body2D *Body, float DeltaTime) {
-        Jubi__IncrementErrorTick();
-        
-        if (Body == NULL || Body -> Type != BODY_DYNAMIC) {
-            Jubi__SetError(JUBI_ERROR_BODY_NOT_VALID, __func__);
-            
-            return (Vector2){0};
-        }
+        // Removing keeps the order up to date, so anything missing is a new body at the end
+        for (int i = WORLD -> _SortedCount; i < COUNT; i++) SORTED[i] = i;
 
-        if (DeltaTime <= 0) DeltaTime = 0.033f;
+        WORLD -> _SortedCount = COUNT;
 
-        Vector2 GravityForce = (Vector2){0, Body -> Mass * GRAVITY};
+        const float *PX = WORLD -> PositionX, *HX = WORLD -> HalfX;
+        float *MIN_X = WORLD -> _MinX, *MAX_X = WORLD -> _MaxX;
 
-        JBody2D_ApplyForce(Body, GravityForce);
+        int i = 0;
 
-        return Body -> AccumulatedForce;
-    }
+        #if defined(JUBI_SIMD_SSE)
+            for (; i + 4 <= COUNT; i += 4) {
+                __m128 P4 = _mm_loadu_ps(&PX[i]), H4 = _mm_loadu_ps(&HX[i]);
 
-    void Jubi_IntegrateBody(Body2D *BODY, float DeltaTime, float Gravity) {
-        Jubi__IncrementErrorTick();
+                _mm_storeu_ps(&MIN_X[i], _mm_sub_ps(P4, H4));
+                _mm_storeu_ps(&MAX_X[i], _mm_add_ps(P4, H4));
+            }
+        #elif defined(JUBI_SIMD_NEON)
+            for (; i + 4 <= COUNT; i += 4) {
+                float32x4_t P4 = vld1q_f32(&PX[i]), H4 = vld1q_f32(&HX[i]);
 
-        if (BODY == NULL) {
-            Jubi__SetError(JUBI_ERROR_NULL_BODY, __func__);
-            
-            return;
-        } else if (DeltaTime <= 0.0f) {
-            Jubi__SetError(JUBI_ERROR_INVALID_VALUE, __func__);
-            
-            return;
+                vst1q_f32(&MIN_X[i], vsubq_f32(P4, H4));
+                vst1q_f32(&MAX_X[i], vaddq_f32(P4, H4));
+            }
+        #endif
+
+        for (; i < COUNT; i++) {
+            MIN_X[i] = PX[i] - HX[i];
+            MAX_X[i] = PX[i] + HX[i];
         }
 
-        if (BODY -> Type == BODY_DYNAMIC && BODY -> InvMass > 0.0f) {
-            JVector2_ApplyGravity(BODY, DeltaTime);
+        float MAX_WIDTH = 0.0f;
 
-            Vector2 Acceleration = {
-                BODY -> AccumulatedForce.x * BODY -> InvMass,
-                BODY -> AccumulatedForce.y * BODY -> InvMass,
-            };
+        // Bodies barely move between steps, so the last order is nearly sorted & insertion sort is close to linear
+        for (int k=0; k < COUNT; k++) {
+            int INDEX = SORTED[k];
+            float KEY = MIN_X[INDEX];
 
-            BODY -> Velocity.x += Acceleration.x * DeltaTime;
-            BODY -> Velocity.y += Acceleration.y * DeltaTime;
+            if (MAX_X[INDEX] - KEY > MAX_WIDTH) MAX_WIDTH = MAX_X[INDEX] - KEY;
 
-            BODY -> Velocity.x *= (1.0f - AIR_RESISTANCE);
-            BODY -> Velocity.y *= (1.0f - AIR_RESISTANCE);
+            int j = k - 1;
 
-            BODY -> Position.x += BODY -> Velocity.x * DeltaTime;
-            BODY -> Position.y += BODY -> Velocity.y * DeltaTime;
+            while (j >= 0 && MIN_X[SORTED[j]] > KEY) {
+                SORTED[j + 1] = SORTED[j];
+                j--;
+            }
 
-            BODY -> AccumulatedForce = (Vector2){0};
+            SORTED[j + 1] = INDEX;
         }
 
-        BODY -> Bounds = JInitialize_AABB(BODY -> Position, BODY -> _Size);
-
-        if (BODY -> Shape == SHAPE_CIRCLE) {
-            BODY -> ShapeData.Circle.Center = BODY -> Position;
-            BODY -> ShapeData.Circle.Radius = BODY -> _Size.x * .5f; // Assuming X is the diameter
-        }
+        WORLD -> _MaxWidthX = MAX_WIDTH;
+        WORLD -> _BroadphaseDirty = 0;
     }
 
-    void Jubi_StepBody2D(Body2D *BODY, float DeltaTime, float Gravity) {
-        Jubi_IntegrateBody(BODY, DeltaTime, BODY -> WORLD ? BODY -> WORLD -> Gravity : GRAVITY);
-    }
+    // Contact between bodies A & B, NORMAL points from A towards B
+    static int Jubi__CollidePair3D(const JubiWorld3D *WORLD, int A, int B, Vector3 *NORMAL, float *DEPTH) {
+        float DX = WORLD -> PositionX[B] - WORLD -> PositionX[A];
+        float DY = WORLD -> PositionY[B] - WORLD -> PositionY[A];
+        float DZ = WORLD -> PositionZ[B] - WORLD -> PositionZ[A];
 
-    // Vector2 Collision Detection
+        int SPHERE_A = WORLD -> Shape[A] == SHAPE3D_SPHERE, SPHERE_B = WORLD -> Shape[B] == SHAPE3D_SPHERE;
 
-    int JCollision_AABBvsAABB(const AABB A, const AABB B) {
-        return (A.Min.x < B.Max.x && A.Max.x > B.Min.x && A.Min.y < B.Max.y && A.Max.y > B.Min.y) ? 1 : 0;
-    }
+        if (SPHERE_A && SPHERE_B) {
+            float RADII = WORLD -> HalfX[A] + WORLD -> HalfX[B];
+            float DISTANCE_SQ = DX * DX + DY * DY + DZ * DZ;
 
-    int JCollision_CirclevsCircle(Circle2D A, Circle2D B) {
-        float DISTANCE = JVector2_Distance(A.Center, B.Center);
-        float RADIUS_SUM = A.Radius + B.Radius;
+            if (DISTANCE_SQ >= RADII * RADII) return 0;
+
+            float DISTANCE = sqrtf(DISTANCE_SQ);
+
+            *NORMAL = DISTANCE > 0.0f ? (Vector3){DX / DISTANCE, DY / DISTANCE, DZ / DISTANCE, 0} : (Vector3){0, -1, 0, 0};
+            *DEPTH = RADII - DISTANCE;
 
-        if (DISTANCE < RADIUS_SUM)
             return 1;
+        }
 
-        return 0;
-    }
+        if (SPHERE_A != SPHERE_B) {
+            int SPHERE = SPHERE_A ? A : B, BOX = SPHERE_A ? B : A;
+            float SIGN = SPHERE_A ? -1.0f : 1.0f; // Turns A -> B into box -> sphere
 
-    int JCollision_AABBvsCircle(AABB A, Circle2D B) {
-        float CLOSEST_X = JClamp(B.Center.x, A.Min.x, A.Max.x);
-        float CLOSEST_Y = JClamp(B.Center.y, A.Min.y, A.Max.y);
+            float OFFSET[3] = {DX * SIGN, DY * SIGN, DZ * SIGN};
+            float HALF[3] = {WORLD -> HalfX[BOX], WORLD -> HalfY[BOX], WORLD -> HalfZ[BOX]};
 
-        float DISTANCE_X = B.Center.x - CLOSEST_X;
-        float DISTANCE_Y = B.Center.y - CLOSEST_Y;
+            // Sphere center minus the closest point of the box to it
+            float AWAY[3], AWAY_SQ = 0.0f;
 
-        float DISTANCE_SQUARED = (DISTANCE_X * DISTANCE_X) + (DISTANCE_Y * DISTANCE_Y);
-        float RADIUS_SQUARED = B.Radius * B.Radius;
+            for (int Axis = 0; Axis < 3; Axis++) {
+                float CLOSEST = OFFSET[Axis] < -HALF[Axis] ? -HALF[Axis] : (OFFSET[Axis] > HALF[Axis] ? HALF[Axis] : OFFSET[Axis]);
 
-        if (DISTANCE_SQUARED < RADIUS_SQUARED)
-            return 1;
+                AWAY[Axis] = OFFSET[Axis] - CLOSEST;
+                AWAY_SQ += AWAY[Axis] * AWAY[Axis];
+            }
 
-        return 0;
-    }
+            float RADIUS = WORLD -> HalfX[SPHERE];
 
-    void JCollision_ResolveAABBvsAABB(Body2D *A, Body2D *B) {
-        if (!A || !B) return;
-        
-        float OverlapX = fminf(A -> Bounds.Max.x, B -> Bounds.Max.x) - fmaxf(A -> Bounds.Min.x, B -> Bounds.Min.x);
-        float OverlapY = fminf(A -> Bounds.Max.y, B -> Bounds.Max.y) - fmaxf(A -> Bounds.Min.y, B -> Bounds.Min.y);
+            if (AWAY_SQ >= RADIUS * RADIUS) return 0;
 
-        if (OverlapX <= 0 || OverlapY <= 0) return;
-        if (OverlapX < OverlapY) {
-            float Push = OverlapX * 0.5f;
+            // A center inside the box falls through to the box test below, treating the sphere as its bounds
+            if (AWAY_SQ > 0.0f) {
+                float DISTANCE = sqrtf(AWAY_SQ);
 
-            if (A -> InvMass > 0) A -> Position.x -= Push * (A -> InvMass / (A -> InvMass + B->InvMass > 0 ? (A -> InvMass + B -> InvMass) : 1));
-            if (B -> InvMass > 0) B -> Position.x += Push * (B -> InvMass / (A -> InvMass + B->InvMass > 0 ? (A -> InvMass + B -> InvMass) : 1));
+                *NORMAL = (Vector3){AWAY[0] / DISTANCE * SIGN, AWAY[1] / DISTANCE * SIGN, AWAY[2] / DISTANCE * SIGN, 0};
+                *DEPTH = RADIUS - DISTANCE;
 
-            A -> Velocity.x = 0; B->Velocity.x = 0;
-        } else {
-            float Push = OverlapY * 0.5f;
+                return 1;
+            }
+        }
 
-            if (A -> InvMass > 0) A -> Position.y -= Push * (A -> InvMass / (A -> InvMass + B -> InvMass > 0 ? (A -> InvMass + B -> InvMass) : 1));
-            if (B -> InvMass > 0) B -> Position.y += Push * (B -> InvMass / (A -> InvMass + B -> InvMass > 0 ? (A -> InvMass + B -> InvMass) : 1));
+        // Boxes separate along the axis they overlap least on
+        float OVERLAP_X = WORLD -> HalfX[A] + WORLD -> HalfX[B] - fabsf(DX);
+        float OVERLAP_Y = WORLD -> HalfY[A] + WORLD -> HalfY[B] - fabsf(DY);
+        float OVERLAP_Z = WORLD -> HalfZ[A] + WORLD -> HalfZ[B] - fabsf(DZ);
 
-            A -> Velocity.y = 0; B -> Velocity.y = 0;
+        if (OVERLAP_X <= 0.0f || OVERLAP_Y <= 0.0f || OVERLAP_Z <= 0.0f) return 0;
+
+        if (OVERLAP_X < OVERLAP_Y && OVERLAP_X < OVERLAP_Z) {
+            *NORMAL = (Vector3){DX < 0.0f ? -1.0f : 1.0f, 0, 0, 0};
+            *DEPTH = OVERLAP_X;
+        } else if (OVERLAP_Y < OVERLAP_Z) {
+            *NORMAL = (Vector3){0, DY < 0.0f ? -1.0f : 1.0f, 0, 0};
+            *DEPTH = OVERLAP_Y;
+        } else {
+            *NORMAL = (Vector3){0, 0, DZ < 0.0f ? -1.0f : 1.0f, 0};
+            *DEPTH = OVERLAP_Z;
         }
 
-        A -> Bounds = JInitialize_AABB(A -> Position, A -> _Size);
-        B -> Bounds = JInitialize_AABB(B -> Position, B -> _Size);
+        return 1;
     }
 
-    int JCollision_ResolveCirclevsCircle(Body2D *A, Body2D *B) {
-        A -> Velocity = (Vector2){0, 0};
-        B -> Velocity = (Vector2){0, 0};
-    }
+    // Pushes the pair apart by their inverse masses & removes the velocity closing the contact, with the lower restitution of the two. Velocity along the contact is kept, unlike the 2D resolver.
+    static void Jubi__ResolvePair3D(JubiWorld3D *WORLD, int A, int B) {
+        float INV_A = WORLD -> InvMass[A], INV_B = WORLD -> InvMass[B];
+        float INV_SUM = INV_A + INV_B;
 
-    int JCollision_ResolveAABBvsCircle(Body2D *A, Body2D *B) {
-        A -> Velocity = (Vector2){0, 0};
-        B -> Velocity = (Vector2){0, 0};
+        Vector3 NORMAL;
+        float DEPTH;
+
+        if (INV_SUM <= 0.0f || !Jubi__CollidePair3D(WORLD, A, B, &NORMAL, &DEPTH)) return;
+
+        float PUSH = DEPTH > JUBI_CONTACT_SLOP_3D ? (DEPTH - JUBI_CONTACT_SLOP_3D) * JUBI_CONTACT_CORRECTION_3D / INV_SUM : 0.0f;
+
+        WORLD -> PositionX[A] -= NORMAL.x * PUSH * INV_A;
+        WORLD -> PositionY[A] -= NORMAL.y * PUSH * INV_A;
+        WORLD -> PositionZ[A] -= NORMAL.z * PUSH * INV_A;
+
+        WORLD -> PositionX[B] += NORMAL.x * PUSH * INV_B;
+        WORLD -> PositionY[B] += NORMAL.y * PUSH * INV_B;
+        WORLD -> PositionZ[B] += NORMAL.z * PUSH * INV_B;
+
+        float CLOSING = (WORLD -> VelocityX[B] - WORLD -> VelocityX[A]) * NORMAL.x + (WORLD -> VelocityY[B] - WORLD -> VelocityY[A]) * NORMAL.y + (WORLD -> VelocityZ[B] - WORLD -> VelocityZ[A]) * NORMAL.z;
+
+        if (CLOSING >= 0.0f) return;
+
+        float RESTITUTION = WORLD -> Restitution[A] < WORLD -> Restitution[B] ? WORLD -> Restitution[A] : WORLD -> Restitution[B];
+        float IMPULSE = -(1.0f + RESTITUTION) * CLOSING / INV_SUM;
+
+        WORLD -> VelocityX[A] -= NORMAL.x * IMPULSE * INV_A;
+        WORLD -> VelocityY[A] -= NORMAL.y * IMPULSE * INV_A;
+        WORLD -> VelocityZ[A] -= NORMAL.z * IMPULSE * INV_A;
+
+        WORLD -> VelocityX[B] += NORMAL.x * IMPULSE * INV_B;
+        WORLD -> VelocityY[B] += NORMAL.y * IMPULSE * INV_B;
+        WORLD -> VelocityZ[B] += NORMAL.z * IMPULSE * INV_B;
     }
 
 #endif // JUBI_IMPLEMENTATION
@@ -0,0 +1,176 @@
+/*
+
+    Jubi Physics Library | C++ Layer
+    --------------------------------
+
+    Optional C++ wrapper around Jubi.h. Worlds are templates over a body
+    limit & the step features they use, so the compiler only keeps the
+    parts of the step a world can actually reach.
+
+    Early Development | IN DEVELOPMENT
+    Created by Averi | GitHub: @Avery-Personal
+
+    License: ALLPU License
+
+===========================================================
+                      VERSION INFORMATION
+
+Jubi Version: 0.2.1
+C++ Language Standard: C++11 or later
+
+Jubi.hpp wraps the same C core as Jubi.h, define JUBI_IMPLEMENTATION before including Jubi.hpp in ONE source file, exactly like Jubi.h.
+
+===========================================================
+                     LICENSE INFORMATION
+
+The following software is protected under the ALLPU license.
+More detailed information is present at the root LICENSE
+file AND OR the end of Jubi.h.
+
+*/
+
+#ifndef JUBI_HPP
+#define JUBI_HPP
+
+#if !defined(__cplusplus) || (__cplusplus < 201103L && !defined(_MSC_VER))
+    #error "Jubi.hpp needs C++11 or later, use Jubi.h from C"
+#endif
+
+#include "Jubi.h"
+
+namespace Jubi {
+    // Step features, combine with | for the Features parameter of World2D
+    enum Feature : JUBI_UINT32 {
+        ForceFields = JUBI_STEP_FORCE_FIELDS,
+        Continuous = JUBI_STEP_CONTINUOUS,
+        Polygons = JUBI_STEP_POLYGONS,
+        Joints = JUBI_STEP_JOINTS,
+        Tilemaps = JUBI_STEP_TILEMAPS,
+        Particles = JUBI_STEP_PARTICLES,
+        Streaming = JUBI_STEP_STREAMING,
+        LevelOfDetail = JUBI_STEP_LOD,
+        All = JUBI_STEP_ALL
+    };
+
+    // BodyLimit only caps how many bodies the world accepts, it doesn't shrink it. Every World2D holds a whole JubiWorld2D (room for JUBI_MAX_BODIES, about 160 KB by default), so make them static or allocate them, never put one on the stack. Features picks the step phases compiled in, anything left out is skipped & its API is unavailable.
+    template <int BodyLimit = JUBI_MAX_BODIES, JUBI_UINT32 Features = JUBI_STEP_ALL>
+    class World2D {
+        static_assert(BodyLimit > 0 && BodyLimit <= JUBI_MAX_BODIES, "World2D BodyLimit must be between 1 & JUBI_MAX_BODIES");
+
+        public:
+            static constexpr int MaxBodies = BodyLimit;
+            static constexpr JUBI_UINT32 Enabled = Features;
+
+            static constexpr bool Has(JUBI_UINT32 FEATURE) { return (Features & FEATURE) == FEATURE; }
+
+            World2D() : World(Jubi_CreateWorld2D()) {}
+            ~World2D() { Jubi_DestroyWorld2D(&World); }
+
+            World2D(const World2D &) = delete;
+            World2D &operator=(const World2D &) = delete;
+
+            void Step(float DeltaTime) {
+                #ifdef JUBI_IMPLEMENTATION
+                    // The core is in this file, call it directly so Features is a constant inside the step
+                    Jubi__IncrementErrorTick();
+
+                    if (Jubi_IsWorldValid(&World) < 1) {
+                        Jubi__SetError(Jubi_GetWorldError(Jubi_IsWorldValid(&World)), __func__);
+
+                        return;
+                    }
+
+                    Jubi__FinishAsync2D(&World);
+                    Jubi__StepWorld2D(&World, DeltaTime, Features);
+                #else
+                    Jubi_StepWorld2DEx(&World, DeltaTime, Features);
+                #endif
+            }
+
+            void Clear() { Jubi_ClearWorld2D(&World); }
+
+            // Bodies are returned by handle, JUBI_INVALID_HANDLE when the world is full or the body is invalid
+
+            int CreateBox(Vector2 Position, Vector2 Size, BodyType2D Type, float Mass) {
+                if (Full()) return JUBI_INVALID_HANDLE;
+
+                return HandleOf(JBody2D_CreateBox(&World, Position, Size, Type, Mass));
+            }
+
+            int CreateCircle(Vector2 Position, Vector2 Size, BodyType2D Type, float Mass) {
+                if (Full()) return JUBI_INVALID_HANDLE;
+
+                return HandleOf(JBody2D_CreateCircle(&World, Position, Size, Type, Mass));
+            }
+
+            int CreateFromShape(Vector2 Position, int ShapeId, BodyType2D Type, float Mass) {
+                if (Full()) return JUBI_INVALID_HANDLE;
+
+                return HandleOf(JBody2D_CreateFromShape(&World, Position, ShapeId, Type, Mass));
+            }
+
+            template <JUBI_UINT32 F = Features>
+            int CreatePolygon(Vector2 Position, const Vector2 *VERTICES, int COUNT, BodyType2D Type, float Mass) {
+                static_assert((F & JUBI_STEP_POLYGONS) != 0, "World2D was built without Jubi::Polygons");
+
+                if (Full()) return JUBI_INVALID_HANDLE;
+
+                return HandleOf(JBody2D_CreatePolygon(&World, Position, VERTICES, COUNT, Type, Mass));
+            }
+
+            int Destroy(int HANDLE) { return JBody2D_DestroyBatch(&World, &HANDLE, 1); }
+
+            Body2D *Get(int HANDLE) { return Jubi_GetBodyFromHandle2D(&World, HANDLE); }
+
+            template <JUBI_UINT32 F = Features>
+            void SetBullet(int HANDLE, bool ENABLED) {
+                static_assert((F & JUBI_STEP_CONTINUOUS) != 0, "World2D was built without Jubi::Continuous");
+
+                JBody2D_SetBullet(Get(HANDLE), ENABLED ? 1 : 0);
+            }
+
+            void SetSensor(int HANDLE, bool ENABLED) { JBody2D_SetSensor(Get(HANDLE), ENABLED ? 1 : 0); }
+
+            template <JUBI_UINT32 F = Features>
+            int AddForceField(JubiForceField2D FIELD) {
+                static_assert((F & JUBI_STEP_FORCE_FIELDS) != 0, "World2D was built without Jubi::ForceFields");
+
+                return Jubi_AddForceField2D(&World, FIELD);
+            }
+
+            template <JUBI_UINT32 F = Features>
+            int RemoveForceField(int INDEX) {
+                static_assert((F & JUBI_STEP_FORCE_FIELDS) != 0, "World2D was built without Jubi::ForceFields");
+
+                return Jubi_RemoveForceField2D(&World, INDEX);
+            }
+
+            template <JUBI_UINT32 F = Features>
+            int AddJoint(JubiJoint2D JOINT) {
+                static_assert((F & JUBI_STEP_JOINTS) != 0, "World2D was built without Jubi::Joints");
+
+                return Jubi_AddJoint2D(&World, JOINT);
+            }
+
+            template <JUBI_UINT32 F = Features>
+            int RemoveJoint(int ID) {
+                static_assert((F & JUBI_STEP_JOINTS) != 0, "World2D was built without Jubi::Joints");
+
+                return Jubi_RemoveJoint2D(&World, ID);
+            }
+
+            int BodyCount() const { return World.BodyCount; }
+            bool Full() const { return World.BodyCount >= BodyLimit; }
+
+            // The underlying C world, for anything the wrapper doesn't cover
+            JubiWorld2D *C() { return &World; }
+            const JubiWorld2D *C() const { return &World; }
+
+        private:
+            static int HandleOf(const Body2D *BODY) { return BODY ? BODY -> Handle : JUBI_INVALID_HANDLE; }
+
+            JubiWorld2D World;
+    };
+}
+
+#endif
@@ -0,0 +1,132 @@
+/*
+===========================================================
+                     TEST INFORMATION
+
+TEST NAME: AsyncStep.c
+CREATION DATE: 26/10/18 | International Date Format
+LAST MODIFIED: 26/10/18 | International Date Format
+
+===========================================================
+                      TEST PURPOSE
+
+This test is to check async stepping. One world is stepped
+in the background while the main thread queues forces &
+reads the previous step's transforms, another identical
+world is stepped normally with the same forces.
+
+If working correctly, the program should say that both
+worlds ended up the same, that every fence finished, & how
+much of each async step the main thread could spend on
+other work.
+
+===========================================================
+                   LICENSE INFORMATION
+
+The following software is protected under the MIT license.
+More detailed information is present at the root LICENSE
+file AND OR the end of the file.
+
+===========================================================
+*/
+
+#define JUBI_ENABLE_THREADS
+#define JUBI_IMPLEMENTATION
+#include "../Jubi.h"
+
+#include <stdio.h>
+
+#define STEPS 240
+
+static void FillWorld(JubiWorld2D *WORLD) {
+    *WORLD = Jubi_CreateWorld2D();
+
+    JBody2D_CreateBox(WORLD, (Vector2){0, 20}, (Vector2){200, 2}, BODY_STATIC, 0.0f);
+
+    for (int i=0; i < 600; i++)
+        JBody2D_CreateBox(WORLD, (Vector2){(float)(i % 40) * 1.5f - 30.0f, (float)(i / 40) * -1.5f}, (Vector2){1.4f, 1.4f}, BODY_DYNAMIC, 1.0f);
+}
+
+// The "input" for step i, pushing box 1 around
+static Vector2 Push(int STEP) {
+    return (Vector2){(float)((STEP * 37) % 11) - 5.0f, -(float)(STEP % 7) * 3.0f};
+}
+
+int main() {
+    static JubiWorld2D ASYNC, SYNC;
+
+    FillWorld(&ASYNC);
+    FillWorld(&SYNC);
+
+    Jubi_EnableTransformOutput2D(&ASYNC, 1);
+
+    int HANDLE = ASYNC.Bodies[1].Handle;
+    int UNFINISHED = 0;
+    long POLLS = 0;
+    int FRAMES = 0;
+
+    for (int i=0; i < STEPS; i++) {
+        JubiStepFence2D FENCE = Jubi_StepWorld2DAsync(&ASYNC, 0.016f);
+
+        // Everything the main thread may do while the step runs. Forces queued now land on the next step.
+        if (i + 1 < STEPS) Jubi_QueueForce2D(&ASYNC, HANDLE, Push(i + 1));
+
+        const JubiTransformFrame2D *FRAME = Jubi_AcquireTransforms2D(&ASYNC);
+        if (FRAME -> Count > 0) FRAMES++;
+
+        while (!Jubi_PollStep2D(FENCE))
+            POLLS++;
+
+        Jubi_WaitStep2D(FENCE);
+
+        if (!Jubi_PollStep2D(FENCE)) UNFINISHED++;
+    }
+
+    for (int i=0; i < STEPS; i++) {
+        if (i > 0) Jubi_QueueForce2D(&SYNC, HANDLE, Push(i));
+
+        Jubi_StepWorld2D(&SYNC, 0.016f);
+    }
+
+    int DIFFERENT = 0;
+
+    for (int i=0; i < SYNC.BodyCount; i++) {
+        if (ASYNC.Bodies[i].Position.x != SYNC.Bodies[i].Position.x || ASYNC.Bodies[i].Position.y != SYNC.Bodies[i].Position.y) DIFFERENT++;
+    }
+
+    printf("Bodies different from the normal world: %d of %d\n", DIFFERENT, SYNC.BodyCount);
+    printf("Unfinished fences after waiting: %d, frames read during steps: %d\n", UNFINISHED, FRAMES);
+    printf("Polls while stepping: %ld (about %ld per step)\n", POLLS, POLLS / STEPS);
+
+    int PASSED = DIFFERENT == 0 && UNFINISHED == 0 && ASYNC.StepCount == STEPS && FRAMES > 0;
+
+    Jubi_DestroyWorld2D(&ASYNC);
+    Jubi_DestroyWorld2D(&SYNC);
+
+    return PASSED ? 0 : 1;
+}
+/*
+
+All source code & software are available under the MIT license:
+    MIT License
+
+    Copyright (c) 2025 Averi
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+
+*/
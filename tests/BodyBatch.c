@@ -0,0 +1,154 @@
+/*
+===========================================================
+                     TEST INFORMATION
+
+TEST NAME: BodyBatch.c
+CREATION DATE: 26/10/18 | International Date Format
+LAST MODIFIED: 26/10/18 | International Date Format
+
+===========================================================
+                      TEST PURPOSE
+
+This test is to check batch creation & removal, and that body
+handles stay valid while other bodies come & go. A batch of
+1,000 bodies is created, batches that can't fully fit are
+refused, & every other body is then destroyed in one call with
+repeated & unknown handles mixed in.
+
+If working correctly, the program should say that batches are
+created whole or not at all, that destroying skipped repeated &
+unknown handles, that every remaining handle still finds its
+own body, & that freed handles are handed out again.
+
+===========================================================
+                   LICENSE INFORMATION
+
+The following software is protected under the MIT license.
+More detailed information is present at the root LICENSE
+file AND OR the end of the file.
+
+===========================================================
+*/
+
+#define JUBI_IMPLEMENTATION
+#include "../Jubi.h"
+
+#include <stdio.h>
+
+#define COUNT 1000
+
+static Vector2 POSITIONS[COUNT];
+static Vector2 SIZES[COUNT];
+static int HANDLES[COUNT];
+static int DOOMED[COUNT];
+static int EXTRA[JUBI_MAX_BODIES];
+static int FREED[JUBI_MAX_BODIES];
+
+int main() {
+    static JubiWorld2D WORLD;
+    WORLD = Jubi_CreateWorld2D();
+
+    for (int i=0; i < COUNT; i++) {
+        POSITIONS[i] = (Vector2){(float)i * 2.0f, 0.0f};
+        SIZES[i] = (Vector2){1, 1};
+    }
+
+    JubiBodyBatch2D BATCH = {POSITIONS, SIZES, NULL, NULL, NULL, NULL};
+
+    JubiBodyRange2D RANGE = JBody2D_CreateBatch(&WORLD, &BATCH, COUNT, HANDLES);
+
+    int CREATED = RANGE.First == 0 && RANGE.Count == COUNT && WORLD.BodyCount == COUNT;
+
+    for (int i=0; i < COUNT; i++)
+        if (Jubi_GetBodyFromHandle2D(&WORLD, HANDLES[i]) != &WORLD.Bodies[i]) CREATED = 0;
+
+    // Too many for the space left, & a batch with one bad shape id, neither may create anything
+    RANGE = JBody2D_CreateBatch(&WORLD, &BATCH, JUBI_MAX_BODIES - COUNT + 1, EXTRA);
+
+    int FULL_REFUSED = RANGE.Count == 0 && Jubi_GetLastErrorCode() == JUBI_ERROR_WORLD_FULL && WORLD.BodyCount == COUNT;
+
+    int SHAPE = Jubi_CreateShape2D(&WORLD, SHAPE_BOX, (Vector2){1, 1});
+    int SHAPE_IDS[3] = {SHAPE, SHAPE + 1, SHAPE};
+    JubiBodyBatch2D SHAPED = {POSITIONS, NULL, NULL, NULL, NULL, SHAPE_IDS};
+
+    RANGE = JBody2D_CreateBatch(&WORLD, &SHAPED, 3, EXTRA);
+
+    int SHAPE_REFUSED = RANGE.Count == 0 && WORLD.BodyCount == COUNT;
+
+    // Every other body, each one twice, plus handles that aren't in the world
+    int DOOMED_COUNT = 0;
+
+    for (int i=0; i < COUNT; i += 2) {
+        FREED[HANDLES[i]] = 1;
+        DOOMED[DOOMED_COUNT++] = HANDLES[i];
+        DOOMED[DOOMED_COUNT++] = HANDLES[i];
+    }
+
+    int STRAY[3] = {-1, JUBI_MAX_BODIES, JUBI_MAX_BODIES - 1};
+
+    int REMOVED = JBody2D_DestroyBatch(&WORLD, DOOMED, DOOMED_COUNT) + JBody2D_DestroyBatch(&WORLD, STRAY, 3);
+
+    int DESTROYED = REMOVED == COUNT / 2 && WORLD.BodyCount == COUNT / 2;
+
+    // Survivors moved down the array but keep their handles, & stay in creation order
+    int STABLE = 1;
+
+    for (int i=0; i < COUNT; i++) {
+        Body2D *BODY = Jubi_GetBodyFromHandle2D(&WORLD, HANDLES[i]);
+
+        if (i % 2 == 0) {
+            if (BODY != NULL) STABLE = 0;
+        } else if (BODY == NULL || BODY -> Position.x != POSITIONS[i].x || BODY -> Index != i / 2 || BODY -> Handle != HANDLES[i]) {
+            STABLE = 0;
+        }
+    }
+
+    // Freed handles go out again before any never used one
+    RANGE = JBody2D_CreateBatch(&WORLD, &BATCH, COUNT / 2, EXTRA);
+
+    int REUSED = RANGE.Count == COUNT / 2 && WORLD.BodyCount == COUNT;
+
+    for (int i=0; i < COUNT / 2; i++) {
+        Body2D *BODY = Jubi_GetBodyFromHandle2D(&WORLD, EXTRA[i]);
+
+        if (BODY == NULL || BODY -> Index != RANGE.First + i || FREED[EXTRA[i]] != 1) REUSED = 0;
+    }
+
+    printf("Batch of %d created at one range with working handles: %s\n", COUNT, CREATED ? "yes" : "NO");
+    printf("Batches that don't fit refused without creating anything: %s (world full), %s (bad shape id)\n", FULL_REFUSED ? "yes" : "NO", SHAPE_REFUSED ? "yes" : "NO");
+    printf("Removed %d bodies, repeated & unknown handles skipped: %s\n", REMOVED, DESTROYED ? "yes" : "NO");
+    printf("Remaining handles still find their bodies: %s\n", STABLE ? "yes" : "NO");
+    printf("Freed handles handed out again: %s\n", REUSED ? "yes" : "NO");
+
+    int PASSED = CREATED && FULL_REFUSED && SHAPE_REFUSED && DESTROYED && STABLE && REUSED;
+
+    Jubi_DestroyWorld2D(&WORLD);
+
+    return PASSED ? 0 : 1;
+}
+/*
+
+All source code & software are available under the MIT license:
+    MIT License
+
+    Copyright (c) 2025 Averi
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+
+*/
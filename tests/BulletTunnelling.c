@@ -0,0 +1,85 @@
+/*
+===========================================================
+                     TEST INFORMATION
+
+TEST NAME: BulletTunnelling.c
+CREATION DATE: 26/10/18 | International Date Format
+LAST MODIFIED: 26/10/18 | International Date Format
+
+===========================================================
+                      TEST PURPOSE
+
+This test is to check continuous collision on fast bodies.
+Two boxes are fired at a thin static wall at a speed that
+covers far more than the wall's width in a single step.
+
+If working correctly, the program should say that the
+normal box tunnelled through the wall, and the bullet box
+was stopped in front of it.
+
+===========================================================
+                   LICENSE INFORMATION
+
+The following software is protected under the MIT license.
+More detailed information is present at the root LICENSE
+file AND OR the end of the file.
+
+===========================================================
+*/
+
+#define JUBI_IMPLEMENTATION
+#include "../Jubi.h"
+
+#include <stdio.h>
+
+float Fire(int BULLET) {
+    JubiWorld2D WORLD = Jubi_CreateWorld2D();
+
+    JBody2D_CreateBox(&WORLD, (Vector2){10, 0}, (Vector2){0.1f, 100}, BODY_STATIC, 0.0f);
+    Body2D *Box = JBody2D_CreateBox(&WORLD, (Vector2){0, 0}, (Vector2){1, 1}, BODY_DYNAMIC, 1.0f);
+
+    JBody2D_SetBullet(Box, BULLET);
+    JBody2D_ApplyImpulse(Box, (Vector2){900.0f, 0});
+
+    for (int i=0; i < 5; i++)
+        Jubi_StepWorld2D(&WORLD, 0.033f);
+
+    return Box -> Position.x;
+}
+
+int main() {
+    float NORMAL = Fire(0);
+    float BULLET = Fire(1);
+
+    printf("Normal box X: %.3f | %s\n", NORMAL, NORMAL > 10.0f ? "Tunnelled" : "Stopped");
+    printf("Bullet box X: %.3f | %s\n", BULLET, BULLET > 10.0f ? "Tunnelled" : "Stopped");
+
+    return BULLET < 10.0f ? 0 : 1;
+}
+
+/*
+
+All source code & software are available under the MIT license:
+    MIT License
+
+    Copyright (c) 2025 Averi
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+
+*/
@@ -0,0 +1,147 @@
+/*
+===========================================================
+                     TEST INFORMATION
+
+TEST NAME: FlightRecorder.c
+CREATION DATE: 26/10/18 | International Date Format
+LAST MODIFIED: 26/10/18 | International Date Format
+
+===========================================================
+                      TEST PURPOSE
+
+This test is to check the flight recorder. A world of boxes
+is pushed around with forces & impulses, & has boxes added
+& removed, for 600 steps with the recorder on. The recorded
+window is then replayed into an empty world, & the same run
+is timed without the recorder.
+
+If working correctly, the program should say that the replay
+matches the recorded world exactly, how many steps the window
+held, & how much the recorder added to a step.
+
+===========================================================
+                   LICENSE INFORMATION
+
+The following software is protected under the MIT license.
+More detailed information is present at the root LICENSE
+file AND OR the end of the file.
+
+===========================================================
+*/
+
+#define JUBI_IMPLEMENTATION
+#include "../Jubi.h"
+
+#include <stdio.h>
+#include <time.h>
+
+#define STEPS 600
+
+static void FillWorld(JubiWorld2D *WORLD) {
+    *WORLD = Jubi_CreateWorld2D();
+
+    JBody2D_CreateBox(WORLD, (Vector2){0, 20}, (Vector2){200, 2}, BODY_STATIC, 0.0f);
+
+    for (int i=0; i < 400; i++)
+        JBody2D_CreateBox(WORLD, (Vector2){(float)(i % 40) * 1.5f - 30.0f, (float)(i / 40) * -1.5f}, (Vector2){1.4f, 1.4f}, BODY_DYNAMIC, 1.0f);
+}
+
+// The game's input for a step, everything goes through the recorded API
+static void Play(JubiWorld2D *WORLD, int STEP) {
+    for (int i = STEP % 7; i < WORLD -> BodyCount; i += 23)
+        JBody2D_ApplyForce(&WORLD -> Bodies[i], (Vector2){(float)((STEP * 31 + i) % 19) - 9.0f, -(float)((STEP + i) % 13) * 4.0f});
+
+    if (STEP % 9 == 0) JBody2D_ApplyImpulse(&WORLD -> Bodies[WORLD -> BodyCount / 2], (Vector2){3.0f, -8.0f});
+
+    if (STEP % 50 == 0) JBody2D_CreateBox(WORLD, (Vector2){(float)(STEP % 40) - 20.0f, -30.0f}, (Vector2){1.0f, 1.0f}, BODY_DYNAMIC, 2.0f);
+
+    if (STEP % 70 == 0) {
+        int HANDLE = WORLD -> Bodies[1 + STEP % 300].Handle;
+
+        JBody2D_DestroyBatch(WORLD, &HANDLE, 1);
+    }
+}
+
+static double Run(JubiWorld2D *WORLD) {
+    double SECONDS = 0.0;
+
+    for (int i=0; i < STEPS; i++) {
+        clock_t START = clock();
+
+        Play(WORLD, i);
+        Jubi_StepWorld2D(WORLD, 0.016f);
+
+        SECONDS += (double)(clock() - START) / CLOCKS_PER_SEC;
+    }
+
+    return SECONDS * 1e6 / STEPS;
+}
+
+int main() {
+    static JubiWorld2D RECORDED, PLAIN, REPLAY;
+
+    FillWorld(&RECORDED);
+    FillWorld(&PLAIN);
+
+    // 64 KB of events, a keyframe every 60 steps
+    Jubi_EnableRecorder2D(&RECORDED, 64 * 1024, 60);
+
+    double RECORDED_US = Run(&RECORDED);
+    double PLAIN_US = Run(&PLAIN);
+
+    REPLAY = Jubi_CreateWorld2D();
+
+    int REPLAYED = Jubi_ReplayRecording2D(&RECORDED, &REPLAY, 0);
+
+    int DIFFERENT = REPLAY.BodyCount != RECORDED.BodyCount || REPLAY.StepCount != RECORDED.StepCount;
+
+    for (int i=0; i < RECORDED.BodyCount && !DIFFERENT; i++) {
+        const Body2D *A = &RECORDED.Bodies[i], *B = &REPLAY.Bodies[i];
+
+        if (A -> Handle != B -> Handle || A -> Position.x != B -> Position.x || A -> Position.y != B -> Position.y || A -> Velocity.x != B -> Velocity.x || A -> Velocity.y != B -> Velocity.y) DIFFERENT = 1;
+    }
+
+    // The recorder only watches, the run itself must be untouched
+    int CHANGED = 0;
+
+    for (int i=0; i < PLAIN.BodyCount; i++)
+        if (PLAIN.Bodies[i].Position.x != RECORDED.Bodies[i].Position.x || PLAIN.Bodies[i].Position.y != RECORDED.Bodies[i].Position.y) CHANGED++;
+
+    printf("Replayed %d steps (from step %llu), replay matches: %s\n", REPLAYED, (unsigned long long)(RECORDED.StepCount - (JUBI_UINT64)REPLAYED), DIFFERENT ? "NO" : "yes");
+    printf("Bodies the recorder changed: %d\n", CHANGED);
+    printf("Average step: %.2f us recorded, %.2f us without (%+.1f%%)\n", RECORDED_US, PLAIN_US, (RECORDED_US / PLAIN_US - 1.0) * 100.0);
+
+    int PASSED = REPLAYED > 60 && !DIFFERENT && CHANGED == 0;
+
+    Jubi_DestroyWorld2D(&RECORDED);
+    Jubi_DestroyWorld2D(&PLAIN);
+    Jubi_DestroyWorld2D(&REPLAY);
+
+    return PASSED ? 0 : 1;
+}
+/*
+
+All source code & software are available under the MIT license:
+    MIT License
+
+    Copyright (c) 2025 Averi
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+
+*/
@@ -0,0 +1,162 @@
+/*
+===========================================================
+                     TEST INFORMATION
+
+TEST NAME: ForceFields.c
+CREATION DATE: 26/10/18 | International Date Format
+LAST MODIFIED: 26/10/18 | International Date Format
+
+===========================================================
+                      TEST PURPOSE
+
+This test is to check world force fields. Pairs of bodies
+are placed around each type of field (wind, wind limited to
+a region, radial, attractor & a one-shot explosion), one of
+each pair inside the field & one outside, & the fields are
+then removed again.
+
+If working correctly, the program should say that each field
+moved only the bodies it reaches & in the right direction,
+that the explosion was applied once & removed itself, that
+removed fields stop acting, & that invalid fields are refused.
+
+===========================================================
+                   LICENSE INFORMATION
+
+The following software is protected under the MIT license.
+More detailed information is present at the root LICENSE
+file AND OR the end of the file.
+
+===========================================================
+*/
+
+#define JUBI_IMPLEMENTATION
+#include "../Jubi.h"
+
+#include <stdio.h>
+
+static JubiWorld2D WORLD;
+
+static Body2D *Ball(Vector2 POSITION) {
+    return JBody2D_CreateBox(&WORLD, POSITION, (Vector2){1, 1}, BODY_DYNAMIC, 1.0f);
+}
+
+// Sideways speed after one step, gravity only acts on y
+static float SpeedX(int HANDLE) {
+    return Jubi_GetBodyFromHandle2D(&WORLD, HANDLE) -> Velocity.x;
+}
+
+int main() {
+    WORLD = Jubi_CreateWorld2D();
+
+    // Wind everywhere, & wind limited to a region
+    int WINDY = Ball((Vector2){0, 0}) -> Handle;
+
+    int WIND = Jubi_AddForceField2D(&WORLD, JForceField2D_Directional((Vector2){10, 0}));
+
+    Jubi_StepWorld2D(&WORLD, 0.016f);
+
+    int WIND_OK = SpeedX(WINDY) > 0.0f;
+
+    Jubi_RemoveForceField2D(&WORLD, WIND);
+    Jubi_ClearWorld2D(&WORLD);
+
+    int INSIDE = Ball((Vector2){0, 0}) -> Handle, OUTSIDE = Ball((Vector2){50, 0}) -> Handle;
+
+    JubiForceField2D GUST = JForceField2D_Directional((Vector2){10, 0});
+    JForceField2D_SetRegion(&GUST, (AABB){{-5, -5}, {5, 5}});
+
+    int GUST_ID = Jubi_AddForceField2D(&WORLD, GUST);
+
+    Jubi_StepWorld2D(&WORLD, 0.016f);
+
+    int REGION_OK = SpeedX(INSIDE) > 0.0f && SpeedX(OUTSIDE) == 0.0f;
+
+    // Removing it stops the push, drag only slows the body down
+    Jubi_RemoveForceField2D(&WORLD, GUST_ID);
+
+    float BEFORE = SpeedX(INSIDE);
+    Jubi_StepWorld2D(&WORLD, 0.016f);
+
+    int REMOVED_OK = SpeedX(INSIDE) < BEFORE && Jubi_RemoveForceField2D(&WORLD, GUST_ID) == 0;
+
+    // Radial fields push away from the center, attractors pull in, both only within the radius
+    Jubi_ClearWorld2D(&WORLD);
+
+    int RIGHT = Ball((Vector2){3, 0}) -> Handle, FAR = Ball((Vector2){30, 0}) -> Handle;
+
+    int RADIAL = Jubi_AddForceField2D(&WORLD, JForceField2D_Radial((Vector2){0, 0}, 10.0f, 50.0f));
+
+    Jubi_StepWorld2D(&WORLD, 0.016f);
+
+    int RADIAL_OK = SpeedX(RIGHT) > 0.0f && SpeedX(FAR) == 0.0f;
+
+    Jubi_RemoveForceField2D(&WORLD, RADIAL);
+    Jubi_ClearWorld2D(&WORLD);
+
+    RIGHT = Ball((Vector2){3, 0}) -> Handle;
+    FAR = Ball((Vector2){30, 0}) -> Handle;
+
+    Jubi_AddForceField2D(&WORLD, JForceField2D_Attractor((Vector2){0, 0}, 10.0f, 50.0f));
+
+    Jubi_StepWorld2D(&WORLD, 0.016f);
+
+    int ATTRACTOR_OK = SpeedX(RIGHT) < 0.0f && SpeedX(FAR) == 0.0f;
+
+    // Explosions are one impulse, the slot is free again after the step
+    Jubi_ClearWorld2D(&WORLD);
+
+    RIGHT = Ball((Vector2){3, 0}) -> Handle;
+
+    int BLAST = Jubi_AddForceField2D(&WORLD, JForceField2D_Explosion((Vector2){0, 0}, 10.0f, 50.0f));
+
+    Jubi_StepWorld2D(&WORLD, 0.016f);
+
+    float KICK = SpeedX(RIGHT);
+
+    Jubi_StepWorld2D(&WORLD, 0.016f);
+
+    int EXPLOSION_OK = KICK > 0.0f && SpeedX(RIGHT) < KICK && !WORLD.ForceFields[BLAST].Active;
+
+    int REFUSED = Jubi_AddForceField2D(&WORLD, JForceField2D_Radial((Vector2){0, 0}, 0.0f, 50.0f)) == -1 && Jubi_RemoveForceField2D(&WORLD, JUBI_MAX_FORCE_FIELDS) == -1;
+
+    printf("Wind pushes bodies: %s\n", WIND_OK ? "yes" : "NO");
+    printf("Wind limited to a region only pushes bodies inside it: %s\n", REGION_OK ? "yes" : "NO");
+    printf("Removed fields stop pushing: %s\n", REMOVED_OK ? "yes" : "NO");
+    printf("Radial fields push out within their radius: %s\n", RADIAL_OK ? "yes" : "NO");
+    printf("Attractors pull in within their radius: %s\n", ATTRACTOR_OK ? "yes" : "NO");
+    printf("Explosions apply once & remove themselves: %s\n", EXPLOSION_OK ? "yes" : "NO");
+    printf("Invalid fields & ids refused: %s\n", REFUSED ? "yes" : "NO");
+
+    int PASSED = WIND_OK && REGION_OK && REMOVED_OK && RADIAL_OK && ATTRACTOR_OK && EXPLOSION_OK && REFUSED;
+
+    Jubi_DestroyWorld2D(&WORLD);
+
+    return PASSED ? 0 : 1;
+}
+/*
+
+All source code & software are available under the MIT license:
+    MIT License
+
+    Copyright (c) 2025 Averi
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+
+*/
@@ -0,0 +1,219 @@
+/*
+===========================================================
+                     TEST INFORMATION
+
+TEST NAME: JointChain.c
+CREATION DATE: 26/10/18 | International Date Format
+LAST MODIFIED: 26/10/18 | International Date Format
+
+===========================================================
+                      TEST PURPOSE
+
+This test is to check joints. A 300 link chain of distance
+joints hangs from a static anchor & swings under gravity,
+with a welded pair of boxes on the end. The chain is built
+twice, one stepped on a single thread & one with the joint
+colors split over a thread pool. A few more copies are then
+stepped together as a world group on the same pool, so the
+joint colors are solved from inside the pool's own tasks.
+
+If working correctly, the program should say the chain
+barely stretched, the weld held, & every chain matches.
+
+===========================================================
+                   LICENSE INFORMATION
+
+The following software is protected under the MIT license.
+More detailed information is present at the root LICENSE
+file AND OR the end of the file.
+
+===========================================================
+*/
+
+#define JUBI_ENABLE_THREADS
+#define JUBI_IMPLEMENTATION
+#include "../Jubi.h"
+
+#include <stdio.h>
+#include <time.h>
+
+#define LINKS 300
+#define SPACING 0.5f
+
+static JubiWorld2D SERIAL;
+static JubiWorld2D POOLED;
+static JubiWorld2D REUSED;
+
+#define GROUPED_CHAINS 4
+
+static JubiWorld2D GROUPED[GROUPED_CHAINS];
+
+// A removed body's handle goes to the next body created, which mustn't inherit its joint. Returns how far that body was pulled sideways (gravity only moves it down).
+static float ReusedHandleDrift(int BATCH) {
+    REUSED = Jubi_CreateWorld2D();
+
+    int ANCHOR = JBody2D_CreateBox(&REUSED, (Vector2){0, 0}, (Vector2){0.2f, 0.2f}, BODY_STATIC, 0.0f) -> Handle;
+    Body2D *HANGING = JBody2D_CreateBox(&REUSED, (Vector2){1, 1}, (Vector2){0.2f, 0.2f}, BODY_DYNAMIC, 1.0f);
+
+    int HANDLE = HANGING -> Handle;
+
+    Jubi_AddJoint2D(&REUSED, JJoint2D_Distance(ANCHOR, HANDLE, (Vector2){0, 0}, (Vector2){0, 0}, -1.0f));
+
+    if (BATCH) JBody2D_DestroyBatch(&REUSED, &HANDLE, 1);
+    else Jubi_RemoveBodyFromWorld(&REUSED, HANGING);
+
+    Body2D *BOX = JBody2D_CreateBox(&REUSED, (Vector2){100, 100}, (Vector2){0.2f, 0.2f}, BODY_DYNAMIC, 1.0f);
+    int SAME_HANDLE = BOX -> Handle == HANDLE;
+
+    for (int i=0; i < 10; i++) Jubi_StepWorld2D(&REUSED, 0.016f);
+
+    BOX = Jubi_GetBodyFromHandle2D(&REUSED, HANDLE);
+    float DRIFT = SAME_HANDLE ? fabsf(BOX -> Position.x - 100.0f) : -1.0f;
+
+    Jubi_DestroyWorld2D(&REUSED);
+
+    return DRIFT;
+}
+
+// Sideways, so the chain swings down
+static int BuildChain(JubiWorld2D *WORLD) {
+    *WORLD = Jubi_CreateWorld2D();
+
+    int PREVIOUS = JBody2D_CreateBox(WORLD, (Vector2){0, 0}, (Vector2){0.2f, 0.2f}, BODY_STATIC, 0.0f) -> Handle;
+
+    for (int i=1; i <= LINKS; i++) {
+        int LINK = JBody2D_CreateBox(WORLD, (Vector2){(float)i * SPACING, 0}, (Vector2){0.2f, 0.2f}, BODY_DYNAMIC, 1.0f) -> Handle;
+
+        Jubi_AddJoint2D(WORLD, JJoint2D_Distance(PREVIOUS, LINK, (Vector2){0, 0}, (Vector2){0, 0}, -1.0f));
+
+        PREVIOUS = LINK;
+    }
+
+    int WELDED = JBody2D_CreateBox(WORLD, (Vector2){(float)LINKS * SPACING + 0.3f, 0.3f}, (Vector2){0.2f, 0.2f}, BODY_DYNAMIC, 1.0f) -> Handle;
+
+    Jubi_AddJoint2D(WORLD, JJoint2D_Weld(PREVIOUS, WELDED));
+
+    return WELDED;
+}
+
+// Chains stepped as a world group. Returns how many of their bodies ended up somewhere other than the serial chain's.
+static int GroupedMismatches(JubiScheduler *SCHEDULER, int STEPS) {
+    JubiWorld2D *POINTERS[GROUPED_CHAINS];
+
+    for (int i=0; i < GROUPED_CHAINS; i++) {
+        BuildChain(&GROUPED[i]);
+
+        POINTERS[i] = &GROUPED[i];
+    }
+
+    JubiWorldGroup2D GROUP = Jubi_CreateWorldGroup2D(POINTERS, GROUPED_CHAINS);
+
+    Jubi_SetScheduler(SCHEDULER);
+
+    for (int i=0; i < STEPS; i++)
+        Jubi_StepWorldGroup2D(&GROUP, 0.016f);
+
+    Jubi_SetScheduler(NULL);
+    Jubi_DestroyWorldGroup2D(&GROUP);
+
+    int MISMATCHES = 0;
+
+    for (int i=0; i < GROUPED_CHAINS; i++) {
+        for (int j=0; j < SERIAL.BodyCount; j++)
+            MISMATCHES += SERIAL.Bodies[j].Position.x != GROUPED[i].Bodies[j].Position.x || SERIAL.Bodies[j].Position.y != GROUPED[i].Bodies[j].Position.y;
+
+        Jubi_DestroyWorld2D(&GROUPED[i]);
+    }
+
+    return MISMATCHES;
+}
+
+int main() {
+    int WELDED = BuildChain(&SERIAL);
+    BuildChain(&POOLED);
+
+    JubiThreadPool *POOL = Jubi_CreateThreadPool(3);
+    JubiScheduler SCHEDULER = Jubi_ThreadPoolScheduler(POOL);
+
+    double SECONDS = 0.0;
+
+    for (int i=0; i < 600; i++) {
+        clock_t START = clock();
+
+        Jubi_SetScheduler(NULL);
+        Jubi_StepWorld2D(&SERIAL, 0.016f);
+
+        SECONDS += (double)(clock() - START) / CLOCKS_PER_SEC;
+
+        Jubi_SetScheduler(&SCHEDULER);
+        Jubi_StepWorld2D(&POOLED, 0.016f);
+    }
+
+    Jubi_SetScheduler(NULL);
+
+    int GROUPED_MISMATCHES = GroupedMismatches(&SCHEDULER, 600);
+
+    Jubi_DestroyThreadPool(POOL);
+
+    float WORST = 0.0f;
+
+    for (int i=1; i <= LINKS; i++) {
+        float STRETCH = JVector2_Distance(SERIAL.Bodies[i - 1].Position, SERIAL.Bodies[i].Position) / SPACING - 1.0f;
+
+        if (fabsf(STRETCH) > WORST) WORST = fabsf(STRETCH);
+    }
+
+    Body2D *END = &SERIAL.Bodies[LINKS];
+    Body2D *WELD = Jubi_GetBodyFromHandle2D(&SERIAL, WELDED);
+    Vector2 OFFSET = JVector2_Subtract(WELD -> Position, END -> Position);
+
+    int MISMATCHES = 0;
+
+    for (int i=0; i < SERIAL.BodyCount; i++)
+        MISMATCHES += SERIAL.Bodies[i].Position.x != POOLED.Bodies[i].Position.x || SERIAL.Bodies[i].Position.y != POOLED.Bodies[i].Position.y;
+
+    printf("Chain end: (%f, %f), Joint colors: %d\n", END -> Position.x, END -> Position.y, SERIAL._ColorCount);
+    printf("Worst link stretch: %.2f%%\n", WORST * 100.0f);
+    printf("Weld offset: (%f, %f), expected (0.3, 0.3)\n", OFFSET.x, OFFSET.y);
+    printf("Serial & pooled chains: %s\n", MISMATCHES == 0 ? "Match" : "DIFFER");
+    printf("Bodies in grouped chains that differ: %d\n", GROUPED_MISMATCHES);
+    printf("Average serial step: %.3f ms\n", SECONDS * 1000.0 / 600.0);
+
+    float BATCH_DRIFT = ReusedHandleDrift(1), SINGLE_DRIFT = ReusedHandleDrift(0);
+
+    printf("Body reusing a destroyed body's handle moved by its old joint: %f (batch), %f (single)\n", BATCH_DRIFT, SINGLE_DRIFT);
+
+    int PASSED = WORST < 0.05f && fabsf(OFFSET.x - 0.3f) < 0.01f && fabsf(OFFSET.y - 0.3f) < 0.01f && MISMATCHES == 0 && GROUPED_MISMATCHES == 0 && END -> Position.y > 0.0f && BATCH_DRIFT == 0.0f && SINGLE_DRIFT == 0.0f;
+
+    Jubi_DestroyWorld2D(&SERIAL);
+    Jubi_DestroyWorld2D(&POOLED);
+
+    return PASSED ? 0 : 1;
+}
+
+/*
+
+All source code & software are available under the MIT license:
+    MIT License
+
+    Copyright (c) 2025 Averi
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+
+*/
@@ -0,0 +1,156 @@
+/*
+===========================================================
+                     TEST INFORMATION
+
+TEST NAME: KinematicPlatform.c
+CREATION DATE: 26/10/18 | International Date Format
+LAST MODIFIED: 26/10/18 | International Date Format
+
+===========================================================
+                      TEST PURPOSE
+
+This test is to check kinematic bodies. An elevator carries
+a stack of boxes up past a static wall, & a sliding platform
+shoves a box across the floor, both moved only by the
+velocity they were given.
+
+If working correctly, the program should say that neither
+platform's velocity or path was changed by gravity, forces or
+what they hit, that the boxes rode the elevator up, that the
+pushed box was moved along, & that the platforms passed
+straight through the static floor & wall.
+
+===========================================================
+                   LICENSE INFORMATION
+
+The following software is protected under the MIT license.
+More detailed information is present at the root LICENSE
+file AND OR the end of the file.
+
+===========================================================
+*/
+
+#define JUBI_IMPLEMENTATION
+#include "../Jubi.h"
+
+#include <stdio.h>
+
+#define STEPS 300
+#define RIDERS 4
+
+static int STATIC_OVERLAPS;
+
+// Steps where a platform overlaps the floor or wall, which it has to pass straight through
+static void CountStaticOverlaps(JubiWorld2D *WORLD) {
+    for (int i=0; i < WORLD -> BodyCount; i++) {
+        for (int j = i + 1; j < WORLD -> BodyCount; j++) {
+            Body2D *A = &WORLD -> Bodies[i], *B = &WORLD -> Bodies[j];
+
+            if (A -> Type == BODY_DYNAMIC || B -> Type == BODY_DYNAMIC || A -> Type == B -> Type) continue;
+            if (JCollision_AABBvsAABB(A -> Bounds, B -> Bounds)) STATIC_OVERLAPS++;
+        }
+    }
+}
+
+int main() {
+    static JubiWorld2D WORLD;
+
+    WORLD = Jubi_CreateWorld2D();
+
+    // +y is down, the elevator's right end rises through a wall it doesn't collide with
+    JBody2D_CreateBox(&WORLD, (Vector2){0, 52}, (Vector2){200, 4}, BODY_STATIC, 0.0f);
+    JBody2D_CreateBox(&WORLD, (Vector2){-17.5f, 20}, (Vector2){1, 40}, BODY_STATIC, 0.0f);
+
+    Body2D *ELEVATOR = JBody2D_CreateBox(&WORLD, (Vector2){-20, 48}, (Vector2){8, 1}, BODY_KINEMATIC, 1000.0f);
+    ELEVATOR -> Velocity = (Vector2){0, -4.0f};
+
+    int ELEVATOR_HANDLE = ELEVATOR -> Handle;
+
+    int RIDER_HANDLES[RIDERS];
+
+    for (int i=0; i < RIDERS; i++)
+        RIDER_HANDLES[i] = JBody2D_CreateBox(&WORLD, (Vector2){-23.2f + (float)i * 1.1f, 46.9f}, (Vector2){1, 1}, BODY_DYNAMIC, 1.0f) -> Handle;
+
+    Body2D *SLIDER = JBody2D_CreateBox(&WORLD, (Vector2){20, 48}, (Vector2){2, 4}, BODY_KINEMATIC, 0.0f);
+    SLIDER -> Velocity = (Vector2){3.0f, 0};
+
+    int SLIDER_HANDLE = SLIDER -> Handle;
+    int PUSHED_HANDLE = JBody2D_CreateBox(&WORLD, (Vector2){24, 49.4f}, (Vector2){1, 1}, BODY_DYNAMIC, 1.0f) -> Handle;
+
+    // Forces can't move a kinematic body
+    JBody2D_ApplyForce(ELEVATOR, (Vector2){0, 5000.0f});
+    int FORCE_REJECTED = Jubi_GetLastErrorCode() == JUBI_ERROR_BODY_NOT_VALID;
+
+    // Positions are integrated exactly like the step does, to compare bit for bit
+    Vector2 ELEVATOR_PATH = ELEVATOR -> Position, SLIDER_PATH = SLIDER -> Position;
+
+    int OFF_PATH = 0, VELOCITY_CHANGED = 0;
+
+    for (int s=0; s < STEPS; s++) {
+        Jubi_StepWorld2D(&WORLD, 0.016f);
+        CountStaticOverlaps(&WORLD);
+
+        ELEVATOR_PATH.y += -4.0f * 0.016f;
+        SLIDER_PATH.x += 3.0f * 0.016f;
+
+        const Body2D *E = Jubi_GetBodyFromHandle2D(&WORLD, ELEVATOR_HANDLE);
+        const Body2D *S = Jubi_GetBodyFromHandle2D(&WORLD, SLIDER_HANDLE);
+
+        if (E -> Position.x != ELEVATOR_PATH.x || E -> Position.y != ELEVATOR_PATH.y || S -> Position.x != SLIDER_PATH.x || S -> Position.y != SLIDER_PATH.y) OFF_PATH++;
+        if (E -> Velocity.x != 0.0f || E -> Velocity.y != -4.0f || S -> Velocity.x != 3.0f || S -> Velocity.y != 0.0f) VELOCITY_CHANGED++;
+    }
+
+    const Body2D *E = Jubi_GetBodyFromHandle2D(&WORLD, ELEVATOR_HANDLE);
+
+    // Riders should sit on top of the elevator, a box height above its centre
+    int RIDING = 0;
+
+    for (int i=0; i < RIDERS; i++) {
+        const Body2D *RIDER = Jubi_GetBodyFromHandle2D(&WORLD, RIDER_HANDLES[i]);
+
+        if (fabsf(RIDER -> Position.y - (E -> Position.y - 1.0f)) < 0.6f) RIDING++;
+    }
+
+    const Body2D *PUSHED = Jubi_GetBodyFromHandle2D(&WORLD, PUSHED_HANDLE);
+    const Body2D *S = Jubi_GetBodyFromHandle2D(&WORLD, SLIDER_HANDLE);
+
+    int PUSHED_ALONG = PUSHED -> Position.x >= S -> Bounds.Max.x - 0.6f;
+
+    printf("Force on a kinematic body rejected: %s\n", FORCE_REJECTED ? "yes" : "NO");
+    printf("Steps a platform left its path: %d, steps its velocity changed: %d\n", OFF_PATH, VELOCITY_CHANGED);
+    printf("Boxes riding the elevator up %.1f units: %d of %d\n", 48.0f - E -> Position.y, RIDING, RIDERS);
+    printf("Box pushed along by the slider: %s (x %.2f, slider front %.2f)\n", PUSHED_ALONG ? "yes" : "NO", PUSHED -> Position.x, S -> Bounds.Max.x);
+    printf("Times a platform passed through the floor or wall: %d\n", STATIC_OVERLAPS);
+
+    int PASSED = FORCE_REJECTED && OFF_PATH == 0 && VELOCITY_CHANGED == 0 && RIDING == RIDERS && PUSHED_ALONG && STATIC_OVERLAPS > 0;
+
+    Jubi_DestroyWorld2D(&WORLD);
+
+    return PASSED ? 0 : 1;
+}
+/*
+
+All source code & software are available under the MIT license:
+    MIT License
+
+    Copyright (c) 2025 Averi
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+
+*/
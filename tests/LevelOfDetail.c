@@ -0,0 +1,134 @@
+/*
+===========================================================
+                     TEST INFORMATION
+
+TEST NAME: LevelOfDetail.c
+CREATION DATE: 26/10/18 | International Date Format
+LAST MODIFIED: 26/10/18 | International Date Format
+
+===========================================================
+                      TEST PURPOSE
+
+This test is to check level of detail stepping. Two worlds
+get the same open map of floors with crates dropped on them,
+one with 4 LOD tiers around an observer at the left end &
+one without, & both are stepped for 5 seconds.
+
+If working correctly, the program should say that crates
+near the observer moved exactly like the full rate world,
+far crates still landed on their floors, how many crates
+each tier holds, & how long a step took in both worlds.
+
+===========================================================
+                   LICENSE INFORMATION
+
+The following software is protected under the MIT license.
+More detailed information is present at the root LICENSE
+file AND OR the end of the file.
+
+===========================================================
+*/
+
+#define JUBI_IMPLEMENTATION
+#include "../Jubi.h"
+
+#include <stdio.h>
+#include <time.h>
+
+#define FLOORS 40
+#define CRATES_PER_FLOOR 24
+#define STEPS 300
+
+static void BuildMap(JubiWorld2D *WORLD) {
+    for (int f=0; f < FLOORS; f++) {
+        float LEFT = (float)f * 50.0f;
+
+        JBody2D_CreateBox(WORLD, (Vector2){LEFT + 25.0f, 10.0f}, (Vector2){50.0f, 2.0f}, BODY_STATIC, 0.0f);
+
+        for (int c=0; c < CRATES_PER_FLOOR; c++)
+            JBody2D_CreateBox(WORLD, (Vector2){LEFT + 1.0f + (float)c * 2.0f, 4.0f - (float)(c % 3)}, (Vector2){1.0f, 1.0f}, BODY_DYNAMIC, 1.0f);
+    }
+}
+
+static double Run(JubiWorld2D *WORLD) {
+    clock_t START = clock();
+
+    for (int i=0; i < STEPS; i++)
+        Jubi_StepWorld2D(WORLD, 0.016f);
+
+    return (double)(clock() - START) / CLOCKS_PER_SEC * 1000.0 / STEPS;
+}
+
+int main() {
+    static JubiWorld2D FULL, LOD;
+    FULL = Jubi_CreateWorld2D();
+    LOD = Jubi_CreateWorld2D();
+
+    BuildMap(&FULL);
+    BuildMap(&LOD);
+
+    Vector2 OBSERVER = {0, 0};
+    float DISTANCES[3] = {100.0f, 400.0f, 900.0f};
+
+    Jubi_SetObservers2D(&LOD, &OBSERVER, 1);
+    Jubi_SetLODTiers2D(&LOD, DISTANCES, 3);
+
+    double FULL_MS = Run(&FULL);
+    double LOD_MS = Run(&LOD);
+
+    int NEAR = 0, NEAR_DIFFERENT = 0, MISSED_FLOOR = 0;
+
+    for (int i=0; i < LOD.BodyCount; i++) {
+        const Body2D *A = &FULL.Bodies[i];
+        const Body2D *B = &LOD.Bodies[i];
+
+        if (B -> Type != BODY_DYNAMIC) continue;
+
+        if (B -> Position.x < 80.0f) {
+            NEAR++;
+
+            if (A -> Position.x != B -> Position.x || A -> Position.y != B -> Position.y) NEAR_DIFFERENT++;
+        }
+
+        // Resting on top of the floor (top at y = 9) like the full rate crate. Slow tiers take bigger steps, so they settle a little deeper.
+        if (fabsf(B -> Bounds.Max.y - 9.0f) > 0.1f || fabsf(A -> Position.y - B -> Position.y) > 0.1f) MISSED_FLOOR++;
+    }
+
+    printf("Near crates: %d, different from the full rate world: %d\n", NEAR, NEAR_DIFFERENT);
+    printf("Crates not resting on their floor: %d of %d\n", MISSED_FLOOR, FLOORS * CRATES_PER_FLOOR);
+    printf("Crates per tier: %d %d %d %d\n", LOD.LOD.Counts[0], LOD.LOD.Counts[1], LOD.LOD.Counts[2], LOD.LOD.Counts[3]);
+    printf("Average step: %.3f ms full rate, %.3f ms with LOD\n", FULL_MS, LOD_MS);
+
+    int PASSED = NEAR > 0 && NEAR_DIFFERENT == 0 && MISSED_FLOOR == 0 && LOD.LOD.Counts[3] > 0;
+
+    Jubi_DestroyWorld2D(&FULL);
+    Jubi_DestroyWorld2D(&LOD);
+
+    return PASSED ? 0 : 1;
+}
+/*
+
+All source code & software are available under the MIT license:
+    MIT License
+
+    Copyright (c) 2025 Averi
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+
+*/
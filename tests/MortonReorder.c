@@ -0,0 +1,164 @@
+/*
+===========================================================
+                     TEST INFORMATION
+
+TEST NAME: MortonReorder.c
+CREATION DATE: 26/10/18 | International Date Format
+LAST MODIFIED: 26/10/18 | International Date Format
+
+===========================================================
+                      TEST PURPOSE
+
+This test is to check reordering body storage by Morton
+code. 128 piles of boxes are spread over a large map, with
+the boxes created in shuffled order so neighbours are
+scattered through memory. The same scene is stepped with &
+without a reorder every 60 steps.
+
+If working correctly, the program should say that every
+handle still points at the same box after reordering, & show
+how far apart in memory touching bodies are & the average
+step time, for both.
+
+===========================================================
+                   LICENSE INFORMATION
+
+The following software is protected under the MIT license.
+More detailed information is present at the root LICENSE
+file AND OR the end of the file.
+
+===========================================================
+*/
+
+#define JUBI_IMPLEMENTATION
+#include "../Jubi.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define PILES 128
+#define PER_PILE 7
+#define STEPS 600
+
+static int HANDLES[PILES * PER_PILE];
+
+static void FillWorld(JubiWorld2D *WORLD) {
+    *WORLD = Jubi_CreateWorld2D();
+
+    int ORDER[PILES * PER_PILE];
+
+    for (int i=0; i < PILES * PER_PILE; i++) ORDER[i] = i;
+
+    srand(45);
+
+    for (int i = PILES * PER_PILE - 1; i > 0; i--) {
+        int j = rand() % (i + 1);
+        int SWAP = ORDER[i]; ORDER[i] = ORDER[j]; ORDER[j] = SWAP;
+    }
+
+    for (int p=0; p < PILES; p++)
+        JBody2D_CreateBox(WORLD, (Vector2){(float)(p % 16) * 60.0f, (float)(p / 16) * 60.0f + 20.0f}, (Vector2){8, 2}, BODY_STATIC, 0.0f);
+
+    for (int i=0; i < PILES * PER_PILE; i++) {
+        int PILE = ORDER[i] / PER_PILE, LEVEL = ORDER[i] % PER_PILE;
+
+        Vector2 POSITION = {(float)(PILE % 16) * 60.0f + (float)(LEVEL % 2), (float)(PILE / 16) * 60.0f + 18.0f - (float)LEVEL * 1.1f};
+
+        HANDLES[ORDER[i]] = JBody2D_CreateBox(WORLD, POSITION, (Vector2){1.0f, 1.0f}, BODY_DYNAMIC, 1.0f) -> Handle;
+    }
+}
+
+// Average bytes between the two bodies of each touching pair, what resolution jumps across
+static double PairDistance(JubiWorld2D *WORLD) {
+    static int FOUND[JUBI_MAX_BODIES];
+
+    double TOTAL = 0.0;
+    int PAIRS = 0;
+
+    for (int i=0; i < WORLD -> BodyCount; i++) {
+        int COUNT = Jubi_QueryAABB2D(WORLD, WORLD -> Bodies[i].Bounds, FOUND, JUBI_MAX_BODIES);
+
+        for (int f=0; f < COUNT; f++) {
+            if (FOUND[f] <= i) continue;
+
+            TOTAL += FOUND[f] - i;
+            PAIRS++;
+        }
+    }
+
+    return PAIRS > 0 ? TOTAL / PAIRS * sizeof(Body2D) : 0.0;
+}
+
+static double Run(JubiWorld2D *WORLD) {
+    // Let the piles settle first, the timing is for the steady state
+    for (int i=0; i < 60; i++) Jubi_StepWorld2D(WORLD, 0.016f);
+
+    clock_t START = clock();
+
+    for (int i=0; i < STEPS; i++) Jubi_StepWorld2D(WORLD, 0.016f);
+
+    return (double)(clock() - START) / CLOCKS_PER_SEC * 1e6 / STEPS;
+}
+
+int main() {
+    static JubiWorld2D PLAIN, REORDERED;
+
+    FillWorld(&PLAIN);
+    FillWorld(&REORDERED);
+
+    REORDERED.ReorderInterval = 60;
+
+    double PLAIN_US = Run(&PLAIN);
+    double REORDERED_US = Run(&REORDERED);
+
+    // Handles still find the same box, by where its pile is
+    int LOST = 0;
+
+    for (int i=0; i < PILES * PER_PILE; i++) {
+        const Body2D *BODY = Jubi_GetBodyFromHandle2D(&REORDERED, HANDLES[i]);
+        int PILE = i / PER_PILE;
+
+        if (BODY == NULL || BODY -> Index != REORDERED._HandleToIndex[HANDLES[i]] || fabsf(BODY -> Position.x - (float)(PILE % 16) * 60.0f) > 5.0f || fabsf(BODY -> Position.y - (float)(PILE / 16) * 60.0f - 15.0f) > 5.0f) LOST++;
+    }
+
+    double PLAIN_DISTANCE = PairDistance(&PLAIN);
+    double REORDERED_DISTANCE = PairDistance(&REORDERED);
+
+    printf("Handles lost by reordering: %d\n", LOST);
+    printf("Distance between touching bodies: %.0f bytes in insertion order, %.0f bytes reordered\n", PLAIN_DISTANCE, REORDERED_DISTANCE);
+    printf("Average step: %.2f us in insertion order, %.2f us reordered (%+.1f%%)\n", PLAIN_US, REORDERED_US, (REORDERED_US / PLAIN_US - 1.0) * 100.0);
+
+    int PASSED = LOST == 0 && REORDERED_DISTANCE < PLAIN_DISTANCE;
+
+    Jubi_DestroyWorld2D(&PLAIN);
+    Jubi_DestroyWorld2D(&REORDERED);
+
+    return PASSED ? 0 : 1;
+}
+/*
+
+All source code & software are available under the MIT license:
+    MIT License
+
+    Copyright (c) 2025 Averi
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+
+*/
@@ -0,0 +1,175 @@
+/*
+===========================================================
+                     TEST INFORMATION
+
+TEST NAME: NetworkEncoding.c
+CREATION DATE: 26/10/18 | International Date Format
+LAST MODIFIED: 26/10/18 | International Date Format
+
+===========================================================
+                      TEST PURPOSE
+
+This test is to check snapshot encoding for networking. A
+server world with 1000 falling boxes is sent to a client
+world every tick, delta encoded against the last tick the
+client acknowledged (3 ticks behind). Boxes are also added
+& removed on the way, & every packet is decoded locally.
+
+If working correctly, the program should say that every
+snapshot round tripped exactly, the client bodies are
+within half a precision step of the server's, how many
+bytes a tick took compared to raw floats, & how fast
+encoding & decoding were.
+
+===========================================================
+                   LICENSE INFORMATION
+
+The following software is protected under the MIT license.
+More detailed information is present at the root LICENSE
+file AND OR the end of the file.
+
+===========================================================
+*/
+
+#define JUBI_IMPLEMENTATION
+#include "../Jubi.h"
+
+#include <stdio.h>
+#include <time.h>
+
+#define BOXES 1000
+#define TICKS 300
+#define LAG 3 // Ticks until the client's acknowledgement reaches the server
+
+static JubiSnapshot2D SENT[LAG + 1]; // Server side, ring by tick
+static JubiSnapshot2D RECEIVED[LAG + 1]; // Client side
+static JUBI_UINT8 PACKET[64 * 1024];
+
+static void FillWorld(JubiWorld2D *WORLD) {
+    *WORLD = Jubi_CreateWorld2D();
+
+    JBody2D_CreateBox(WORLD, (Vector2){0, 30}, (Vector2){400, 2}, BODY_STATIC, 0.0f);
+
+    for (int i=0; i < BOXES; i++)
+        JBody2D_CreateBox(WORLD, (Vector2){(float)(i % 100) * 1.5f - 75.0f, (float)(i / 100) * -1.5f}, (Vector2){1.4f, 1.4f}, BODY_DYNAMIC, 1.0f);
+}
+
+static int Same(const JubiSnapshot2D *A, const JubiSnapshot2D *B) {
+    for (int h=0; h < JUBI_MAX_BODIES; h++) {
+        if (A -> Present[h] != B -> Present[h]) return 0;
+        if (!A -> Present[h]) continue;
+
+        const JubiNetBody2D *X = &A -> Bodies[h], *Y = &B -> Bodies[h];
+
+        if (X -> X != Y -> X || X -> Y != Y -> Y || X -> VX != Y -> VX || X -> VY != Y -> VY) return 0;
+    }
+
+    return A -> Tick == B -> Tick;
+}
+
+int main() {
+    static JubiWorld2D SERVER, CLIENT;
+
+    FillWorld(&SERVER);
+    FillWorld(&CLIENT);
+
+    JubiNetFormat2D FORMAT = {0.01f, 0.01f};
+
+    int MISMATCHED = 0;
+    long BYTES = 0;
+    int BIGGEST = 0;
+    double ENCODE_SECONDS = 0.0, DECODE_SECONDS = 0.0;
+
+    for (int t=0; t < TICKS; t++) {
+        // Churn, so removals & new bodies go over the wire too
+        if (t == 50) JBody2D_CreateBox(&SERVER, (Vector2){0, -20}, (Vector2){2, 2}, BODY_DYNAMIC, 1.0f);
+
+        if (t == 100) {
+            int HANDLES[10];
+
+            for (int i=0; i < 10; i++) HANDLES[i] = SERVER.Bodies[1 + i * 50].Handle;
+
+            JBody2D_DestroyBatch(&SERVER, HANDLES, 10);
+        }
+
+        Jubi_StepWorld2D(&SERVER, 0.016f);
+
+        // The client acknowledged tick t - LAG, nothing before the first one
+        const JubiSnapshot2D *SERVER_BASE = t >= LAG ? &SENT[(t - LAG) % (LAG + 1)] : NULL;
+        const JubiSnapshot2D *CLIENT_BASE = t >= LAG ? &RECEIVED[(t - LAG) % (LAG + 1)] : NULL;
+
+        JubiSnapshot2D *CURRENT = &SENT[t % (LAG + 1)];
+
+        clock_t START = clock();
+        int SIZE = Jubi_EncodeSnapshot2D(&SERVER, &FORMAT, SERVER_BASE, CURRENT, PACKET, sizeof(PACKET));
+        ENCODE_SECONDS += (double)(clock() - START) / CLOCKS_PER_SEC;
+
+        START = clock();
+        int DECODED = Jubi_DecodeSnapshot2D(PACKET, SIZE, CLIENT_BASE, &RECEIVED[t % (LAG + 1)]);
+        DECODE_SECONDS += (double)(clock() - START) / CLOCKS_PER_SEC;
+
+        if (SIZE < 0 || DECODED != 1 || !Same(CURRENT, &RECEIVED[t % (LAG + 1)])) MISMATCHED++;
+
+        BYTES += SIZE;
+        if (SIZE > BIGGEST) BIGGEST = SIZE;
+    }
+
+    // The client drops its bodies the server removed (by handle) before applying the last snapshot
+    const JubiSnapshot2D *LAST = &RECEIVED[(TICKS - 1) % (LAG + 1)];
+    int GONE[JUBI_MAX_BODIES], GONE_COUNT = 0;
+
+    for (int i=0; i < CLIENT.BodyCount; i++)
+        if (!LAST -> Present[CLIENT.Bodies[i].Handle]) GONE[GONE_COUNT++] = CLIENT.Bodies[i].Handle;
+
+    JBody2D_DestroyBatch(&CLIENT, GONE, GONE_COUNT);
+    Jubi_ApplySnapshot2D(&CLIENT, &FORMAT, LAST);
+
+    int OFF = 0;
+
+    for (int i=0; i < CLIENT.BodyCount; i++) {
+        const Body2D *A = &CLIENT.Bodies[i];
+        const Body2D *B = Jubi_GetBodyFromHandle2D(&SERVER, A -> Handle);
+
+        if (B == NULL || fabsf(A -> Position.x - B -> Position.x) > 0.0051f || fabsf(A -> Position.y - B -> Position.y) > 0.0051f) OFF++;
+    }
+
+    long RAW = (long)TICKS * (BOXES + 1) * 4 * (long)sizeof(float);
+
+    printf("Snapshots that didn't round trip: %d of %d\n", MISMATCHED, TICKS);
+    printf("Client bodies off by more than half a step: %d of %d (removed %d)\n", OFF, CLIENT.BodyCount, GONE_COUNT);
+    printf("Bytes per tick: %ld average, %d biggest (raw floats: %ld)\n", BYTES / TICKS, BIGGEST, RAW / TICKS);
+    printf("Encode: %.3f us, Decode: %.3f us per tick\n", ENCODE_SECONDS * 1e6 / TICKS, DECODE_SECONDS * 1e6 / TICKS);
+
+    int PASSED = MISMATCHED == 0 && OFF == 0 && GONE_COUNT == 10 && BYTES < RAW / 4;
+
+    Jubi_DestroyWorld2D(&SERVER);
+    Jubi_DestroyWorld2D(&CLIENT);
+
+    return PASSED ? 0 : 1;
+}
+/*
+
+All source code & software are available under the MIT license:
+    MIT License
+
+    Copyright (c) 2025 Averi
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+
+*/
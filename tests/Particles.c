@@ -0,0 +1,114 @@
+/*
+===========================================================
+                     TEST INFORMATION
+
+TEST NAME: Particles.c
+CREATION DATE: 26/10/18 | International Date Format
+LAST MODIFIED: 26/10/18 | International Date Format
+
+===========================================================
+                      TEST PURPOSE
+
+This test is to check the particle system. A million
+particles are sprayed over a static floor, with a quarter
+of them given a short lifetime, & stepped for 2 seconds.
+
+If working correctly, the program should say that no
+particle fell through the floor, that the short lived
+particles are gone, & how long a step took.
+
+===========================================================
+                   LICENSE INFORMATION
+
+The following software is protected under the MIT license.
+More detailed information is present at the root LICENSE
+file AND OR the end of the file.
+
+===========================================================
+*/
+
+#define JUBI_IMPLEMENTATION
+#include "../Jubi.h"
+
+#include <stdio.h>
+#include <time.h>
+
+#define PARTICLE_COUNT 1000000
+
+static Vector2 POSITIONS[PARTICLE_COUNT];
+static Vector2 VELOCITIES[PARTICLE_COUNT];
+
+int main() {
+    static JubiWorld2D WORLD;
+    WORLD = Jubi_CreateWorld2D();
+
+    Body2D *FLOOR = JBody2D_CreateBox(&WORLD, (Vector2){0, 20}, (Vector2){400, 2}, BODY_STATIC, 0.0f);
+
+    for (int i=0; i < PARTICLE_COUNT; i++) {
+        POSITIONS[i] = (Vector2){(float)(i % 1000) * 0.2f - 100.0f, (float)(i / 1000) * 0.01f};
+        VELOCITIES[i] = (Vector2){(float)((i * 7) % 13) - 6.0f, -(float)((i * 3) % 11)};
+    }
+
+    int QUARTER = PARTICLE_COUNT / 4;
+
+    Jubi_ReserveParticles2D(&WORLD, PARTICLE_COUNT);
+    Jubi_EmitParticles2D(&WORLD, POSITIONS, VELOCITIES, PARTICLE_COUNT - QUARTER, 0.0f);
+    Jubi_EmitParticles2D(&WORLD, POSITIONS, VELOCITIES, QUARTER, 0.5f);
+
+    double SECONDS = 0.0;
+
+    for (int i=0; i < 125; i++) {
+        clock_t START = clock();
+
+        Jubi_StepWorld2D(&WORLD, 0.016f);
+
+        SECONDS += (double)(clock() - START) / CLOCKS_PER_SEC;
+    }
+
+    int THROUGH = 0;
+    int RESTING = 0;
+
+    for (int i=0; i < WORLD.Particles.Count; i++) {
+        float X = WORLD.Particles.X[i], Y = WORLD.Particles.Y[i];
+
+        if (X > FLOOR -> Bounds.Min.x && X < FLOOR -> Bounds.Max.x && Y > FLOOR -> Bounds.Min.y) THROUGH++;
+        if (fabsf(Y - FLOOR -> Bounds.Min.y) < 0.01f) RESTING++;
+    }
+
+    printf("Particles left: %d (expected %d)\n", WORLD.Particles.Count, PARTICLE_COUNT - QUARTER);
+    printf("On the floor: %d, Through the floor: %d\n", RESTING, THROUGH);
+    printf("Average step: %.3f ms for %d particles\n", SECONDS * 1000.0 / 125.0, PARTICLE_COUNT);
+
+    int PASSED = THROUGH == 0 && WORLD.Particles.Count == PARTICLE_COUNT - QUARTER && RESTING > 0;
+
+    Jubi_DestroyWorld2D(&WORLD);
+
+    return PASSED ? 0 : 1;
+}
+
+/*
+
+All source code & software are available under the MIT license:
+    MIT License
+
+    Copyright (c) 2025 Averi
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+
+*/
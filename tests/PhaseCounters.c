@@ -0,0 +1,319 @@
+/*
+===========================================================
+                     TEST INFORMATION
+
+TEST NAME: PhaseCounters.c
+CREATION DATE: 26/10/18 | International Date Format
+LAST MODIFIED: 26/10/18 | International Date Format
+
+===========================================================
+                      TEST PURPOSE
+
+This test is a benchmark harness for the step's phase hook.
+Hardware counters (cycles, instructions, L1 & last level cache
+misses & branch misses) are read at every phase boundary of
+a world of shuffled piles, first stepped as created & then
+with Morton reordering, to show whether a layout change
+helped the cache & not just the clock.
+
+Counters come from perf_event_open on Linux. Where it isn't
+available (other systems, containers, no permissions) the
+harness says so & falls back to timing each phase.
+
+If working correctly, the program should print the counters
+(or times) per phase & per body for both layouts, & that the
+phases entered add up to every step.
+
+===========================================================
+                   LICENSE INFORMATION
+
+The following software is protected under the MIT license.
+More detailed information is present at the root LICENSE
+file AND OR the end of the file.
+
+===========================================================
+*/
+
+#ifndef _GNU_SOURCE
+    #define _GNU_SOURCE // syscall(), clock_gettime()
+#endif
+
+#define JUBI_IMPLEMENTATION
+#include "../Jubi.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#ifdef __linux__
+    #include <errno.h>
+    #include <linux/perf_event.h>
+    #include <sys/ioctl.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif
+
+#define PILES 256
+#define PER_PILE 12
+#define STEPS 300
+
+#define COUNTERS 5
+
+static const char *COUNTER_NAMES[COUNTERS] = {"cycles", "instr", "L1 miss", "LLC miss", "br miss"};
+static const char *PHASE_NAMES[JUBI_PHASE_END] = {"begin", "streaming", "lod", "reorder", "integrate", "broadphase", "continuous", "pairs", "resolve", "tilemaps", "particles", "transforms"};
+
+typedef struct {
+    int Files[COUNTERS]; // -1 where the counter couldn't be opened
+    int Available;
+
+    JubiPhase2D Current;
+    JUBI_UINT64 Last[COUNTERS];
+    double LastClock;
+
+    double Totals[JUBI_PHASE_END][COUNTERS];
+    double Seconds[JUBI_PHASE_END];
+    long Entered[JUBI_PHASE_END + 1];
+} Profile;
+
+static int HANDLES[PILES * PER_PILE];
+static int WARNED; // Why counters are missing is only printed for the first run
+
+#ifdef __linux__
+    static int OpenCounter(JUBI_UINT32 TYPE, JUBI_UINT64 CONFIG, int GROUP) {
+        struct perf_event_attr ATTRIBUTES;
+
+        memset(&ATTRIBUTES, 0, sizeof(ATTRIBUTES));
+
+        ATTRIBUTES.size = sizeof(ATTRIBUTES);
+        ATTRIBUTES.type = TYPE;
+        ATTRIBUTES.config = CONFIG;
+        ATTRIBUTES.disabled = GROUP == -1; // The leader starts the whole group
+        ATTRIBUTES.exclude_kernel = 1; // Allowed without privileges, & leaves out the read() calls themselves
+        ATTRIBUTES.exclude_hv = 1;
+        ATTRIBUTES.read_format = PERF_FORMAT_GROUP;
+
+        return (int)syscall(SYS_perf_event_open, &ATTRIBUTES, 0, -1, GROUP, 0);
+    }
+#endif
+
+static void OpenCounters(Profile *PROFILE) {
+    for (int i=0; i < COUNTERS; i++) PROFILE -> Files[i] = -1;
+
+    PROFILE -> Available = 0;
+
+    #ifdef __linux__
+        const JUBI_UINT32 TYPES[COUNTERS] = {PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE, PERF_TYPE_HW_CACHE, PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE};
+        const JUBI_UINT64 CONFIGS[COUNTERS] = {
+            PERF_COUNT_HW_CPU_CYCLES,
+            PERF_COUNT_HW_INSTRUCTIONS,
+            PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16),
+            PERF_COUNT_HW_CACHE_MISSES,
+            PERF_COUNT_HW_BRANCH_MISSES
+        };
+
+        PROFILE -> Files[0] = OpenCounter(TYPES[0], CONFIGS[0], -1);
+
+        if (PROFILE -> Files[0] < 0) {
+            if (!WARNED) printf("Hardware counters unavailable (%s), timing phases instead\n", strerror(errno));
+
+            WARNED = 1;
+
+            return;
+        }
+
+        // A CPU without one of these still reports the rest
+        for (int i=1; i < COUNTERS; i++) {
+            PROFILE -> Files[i] = OpenCounter(TYPES[i], CONFIGS[i], PROFILE -> Files[0]);
+
+            if (PROFILE -> Files[i] < 0 && !WARNED) printf("Counter '%s' unavailable (%s)\n", COUNTER_NAMES[i], strerror(errno));
+        }
+
+        PROFILE -> Available = 1;
+        WARNED = 1;
+
+        ioctl(PROFILE -> Files[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ioctl(PROFILE -> Files[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    #else
+        if (!WARNED) printf("Hardware counters need Linux, timing phases instead\n");
+
+        WARNED = 1;
+    #endif
+}
+
+static void CloseCounters(Profile *PROFILE) {
+    #ifdef __linux__
+        for (int i=0; i < COUNTERS; i++)
+            if (PROFILE -> Files[i] >= 0) close(PROFILE -> Files[i]);
+    #endif
+
+    PROFILE -> Available = 0;
+}
+
+// Current value of every open counter, in the order they were opened
+static void ReadCounters(Profile *PROFILE, JUBI_UINT64 *VALUES) {
+    for (int i=0; i < COUNTERS; i++) VALUES[i] = 0;
+
+    #ifdef __linux__
+        if (!PROFILE -> Available) return;
+
+        JUBI_UINT64 BUFFER[1 + COUNTERS];
+
+        if (read(PROFILE -> Files[0], BUFFER, sizeof(BUFFER)) <= 0) return;
+
+        int SLOT = 0;
+
+        for (int i=0; i < COUNTERS && SLOT < (int)BUFFER[0]; i++)
+            if (PROFILE -> Files[i] >= 0) VALUES[i] = BUFFER[1 + SLOT++];
+    #endif
+}
+
+// Wall time, clock() counts CPU time across every thread & is too coarse for one phase of one step
+static double Now(void) {
+    struct timespec TIME;
+    clock_gettime(CLOCK_MONOTONIC, &TIME);
+
+    return (double)TIME.tv_sec + (double)TIME.tv_nsec * 1e-9;
+}
+
+// Everything since the last boundary belongs to the phase that was running
+static void OnPhase(void *DATA, JubiPhase2D PHASE) {
+    Profile *PROFILE = (Profile *)DATA;
+
+    JUBI_UINT64 NOW[COUNTERS];
+    ReadCounters(PROFILE, NOW);
+
+    double CLOCK = Now();
+
+    if (PHASE != JUBI_PHASE_BEGIN) {
+        for (int i=0; i < COUNTERS; i++) PROFILE -> Totals[PROFILE -> Current][i] += (double)(NOW[i] - PROFILE -> Last[i]);
+
+        PROFILE -> Seconds[PROFILE -> Current] += CLOCK - PROFILE -> LastClock;
+    }
+
+    for (int i=0; i < COUNTERS; i++) PROFILE -> Last[i] = NOW[i];
+
+    PROFILE -> LastClock = CLOCK;
+    PROFILE -> Current = PHASE;
+    PROFILE -> Entered[PHASE]++;
+}
+
+static void FillWorld(JubiWorld2D *WORLD, int REORDER) {
+    *WORLD = Jubi_CreateWorld2D();
+
+    WORLD -> ReorderInterval = REORDER ? 30 : 0;
+
+    int ORDER[PILES * PER_PILE];
+
+    for (int i=0; i < PILES * PER_PILE; i++) ORDER[i] = i;
+
+    srand(49);
+
+    for (int i = PILES * PER_PILE - 1; i > 0; i--) {
+        int j = rand() % (i + 1);
+        int SWAP = ORDER[i]; ORDER[i] = ORDER[j]; ORDER[j] = SWAP;
+    }
+
+    for (int p=0; p < PILES; p++)
+        JBody2D_CreateBox(WORLD, (Vector2){(float)(p % 16) * 60.0f, (float)(p / 16) * 60.0f + 20.0f}, (Vector2){8, 2}, BODY_STATIC, 0.0f);
+
+    for (int i=0; i < PILES * PER_PILE; i++) {
+        int PILE = ORDER[i] / PER_PILE, LEVEL = ORDER[i] % PER_PILE;
+
+        Vector2 POSITION = {(float)(PILE % 16) * 60.0f + (float)(LEVEL % 2), (float)(PILE / 16) * 60.0f + 18.0f - (float)LEVEL * 1.1f};
+
+        HANDLES[ORDER[i]] = JBody2D_CreateBox(WORLD, POSITION, (Vector2){1.0f, 1.0f}, BODY_DYNAMIC, 1.0f) -> Handle;
+    }
+}
+
+// Steps a fresh world with the hook installed, returns 1 if every step entered BEGIN & END once
+static int Run(JubiWorld2D *WORLD, Profile *PROFILE, int REORDER) {
+    memset(PROFILE, 0, sizeof(Profile));
+
+    FillWorld(WORLD, REORDER);
+    OpenCounters(PROFILE);
+
+    Jubi_SetPhaseHook2D(WORLD, OnPhase, PROFILE);
+
+    for (int s=0; s < STEPS; s++) Jubi_StepWorld2D(WORLD, 0.016f);
+
+    Jubi_SetPhaseHook2D(WORLD, NULL, NULL);
+
+    int COMPLETE = PROFILE -> Entered[JUBI_PHASE_BEGIN] == STEPS && PROFILE -> Entered[JUBI_PHASE_END] == STEPS && PROFILE -> Entered[JUBI_PHASE_RESOLVE] == STEPS;
+
+    CloseCounters(PROFILE);
+    Jubi_DestroyWorld2D(WORLD);
+
+    return COMPLETE;
+}
+
+static void Report(const char *NAME, const Profile *PROFILE, int BODIES, int COUNTED) {
+    printf("\n%s, per body per step:\n%-11s %9s", NAME, "phase", "ns");
+
+    if (COUNTED) for (int i=0; i < COUNTERS; i++) printf(" %9s", COUNTER_NAMES[i]);
+    printf("\n");
+
+    double SCALE = 1.0 / ((double)BODIES * STEPS);
+
+    for (int p=0; p < JUBI_PHASE_END; p++) {
+        if (PROFILE -> Entered[p] == 0) continue;
+
+        printf("%-11s %9.2f", PHASE_NAMES[p], PROFILE -> Seconds[p] * 1e9 * SCALE);
+
+        if (COUNTED) for (int i=0; i < COUNTERS; i++) printf(" %9.3f", PROFILE -> Totals[p][i] * SCALE);
+        printf("\n");
+    }
+}
+
+int main() {
+    static JubiWorld2D WORLD;
+    static Profile SHUFFLED, REORDERED;
+
+    int BODIES = PILES * (PER_PILE + 1);
+
+    int COMPLETE = Run(&WORLD, &SHUFFLED, 0);
+    int COUNTED = SHUFFLED.Available;
+
+    COMPLETE &= Run(&WORLD, &REORDERED, 1);
+
+    // Counters may open but never run (e.g. a VM without a PMU)
+    if (COUNTED && SHUFFLED.Totals[JUBI_PHASE_INTEGRATE][0] == 0.0) {
+        printf("Hardware counters opened but never counted, showing times only\n");
+
+        COUNTED = 0;
+    }
+
+    Report("As created", &SHUFFLED, BODIES, COUNTED);
+    Report("Reordered every 30 steps", &REORDERED, BODIES, COUNTED);
+
+    printf("\nEvery step entered each phase boundary once: %s\n", COMPLETE ? "yes" : "NO");
+
+    int PASSED = COMPLETE;
+
+    return PASSED ? 0 : 1;
+}
+/*
+
+All source code & software are available under the MIT license:
+    MIT License
+
+    Copyright (c) 2025 Averi
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+
+*/
@@ -0,0 +1,96 @@
+/*
+===========================================================
+                     TEST INFORMATION
+
+TEST NAME: PolygonRamp.c
+CREATION DATE: 26/10/18 | International Date Format
+LAST MODIFIED: 26/10/18 | International Date Format
+
+===========================================================
+                      TEST PURPOSE
+
+This test is to check convex polygon shapes. A box & a
+circle are dropped onto a single static triangle ramp,
+which slopes down to the right.
+
+If working correctly, the program should say that both
+bodies landed on the ramp & slid down it, staying on top
+of its surface the whole time.
+
+===========================================================
+                   LICENSE INFORMATION
+
+The following software is protected under the MIT license.
+More detailed information is present at the root LICENSE
+file AND OR the end of the file.
+
+===========================================================
+*/
+
+#define JUBI_IMPLEMENTATION
+#include "../Jubi.h"
+
+#include <stdio.h>
+
+// The ramp's surface runs from (0, 0) to (20, 10), Y points down
+float SurfaceY(float X) {
+    return X * 0.5f;
+}
+
+int main() {
+    static JubiWorld2D WORLD;
+    WORLD = Jubi_CreateWorld2D();
+
+    Vector2 RAMP[3] = {{0, 0}, {20, 10}, {0, 10}};
+
+    JBody2D_CreatePolygon(&WORLD, (Vector2){0, 0}, RAMP, 3, BODY_STATIC, 0.0f);
+
+    Body2D *Box = JBody2D_CreateBox(&WORLD, (Vector2){4, -2}, (Vector2){1, 1}, BODY_DYNAMIC, 1.0f);
+    Body2D *Ball = JBody2D_CreateCircle(&WORLD, (Vector2){8, 0}, (Vector2){1, 1}, BODY_DYNAMIC, 1.0f);
+
+    int BURIED = 0;
+
+    for (int i=0; i < 90; i++) {
+        Jubi_StepWorld2D(&WORLD, 0.016f);
+
+        // The box touches the slope with its bottom left corner, the ball with the point facing against the slope's normal
+        if (Box -> Position.y + 0.5f > SurfaceY(Box -> Position.x - 0.5f) + 0.05f) BURIED = 1;
+        if (Ball -> Position.y + 0.5f * 2.0f / sqrtf(5.0f) > SurfaceY(Ball -> Position.x - 0.5f / sqrtf(5.0f)) + 0.05f) BURIED = 1;
+
+        if (i % 15 == 0)
+            printf("Frame: %02d | Box: (%.3f, %.3f) | Ball: (%.3f, %.3f)\n", i, Box -> Position.x, Box -> Position.y, Ball -> Position.x, Ball -> Position.y);
+    }
+
+    int SLID = Box -> Position.x > 4.5f && Ball -> Position.x > 8.5f;
+
+    printf("Bodies %s the ramp & %s down it.\n", BURIED ? "sank into" : "stayed on", SLID ? "slid" : "did not slide");
+
+    return (!BURIED && SLID) ? 0 : 1;
+}
+
+/*
+
+All source code & software are available under the MIT license:
+    MIT License
+
+    Copyright (c) 2025 Averi
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+
+*/
@@ -0,0 +1,199 @@
+/*
+===========================================================
+                     TEST INFORMATION
+
+TEST NAME: Prediction.c
+CREATION DATE: 26/10/18 | International Date Format
+LAST MODIFIED: 26/10/18 | International Date Format
+
+===========================================================
+                      TEST PURPOSE
+
+This test is to check trajectory prediction. 200 projectiles
+are thrown across a room with a floor & a wall, their next
+1.5 seconds are predicted in one batch, along with a kinematic
+platform sliding through the wall, & the world is then actually
+stepped to compare against.
+
+If working correctly, the program should say that the world
+wasn't changed by predicting, that repeated predictions don't
+keep asking for more scratch memory, that predictions match
+the real paths exactly until a body hits the room & land
+where the real body came to rest, that the platform's path
+matches its real one straight through the wall, & how long
+predicting took compared to cloning the world & stepping the
+clone, which has to end up exactly where the world does even
+after the world it was cloned from is destroyed.
+
+===========================================================
+                   LICENSE INFORMATION
+
+The following software is protected under the MIT license.
+More detailed information is present at the root LICENSE
+file AND OR the end of the file.
+
+===========================================================
+*/
+
+#define JUBI_IMPLEMENTATION
+#include "../Jubi.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define PROJECTILES 200
+#define STEPS 90
+
+static Vector2 PATHS[PROJECTILES][STEPS];
+static Vector2 PLATFORM_PATH[STEPS];
+static Body2D BEFORE[JUBI_MAX_BODIES];
+
+int main() {
+    static JubiWorld2D WORLD, COPY;
+
+    WORLD = Jubi_CreateWorld2D();
+
+    JBody2D_CreateBox(&WORLD, (Vector2){0, 50}, (Vector2){4000, 2}, BODY_STATIC, 0.0f);
+    JBody2D_CreateBox(&WORLD, (Vector2){1200, 0}, (Vector2){2, 96}, BODY_STATIC, 0.0f);
+
+    JubiPrediction2D PREDICTIONS[PROJECTILES];
+
+    // Lanes far enough apart that projectiles never meet each other
+    for (int i=0; i < PROJECTILES; i++) {
+        Body2D *BODY = JBody2D_CreateBox(&WORLD, (Vector2){(float)i * 12.0f - 1200.0f, i % 10 == 0 ? 48.0f : 28.0f + (float)(i % 5) * 4.0f}, (Vector2){1, 1}, BODY_DYNAMIC, 1.0f + (float)(i % 3));
+
+        BODY -> Velocity = (Vector2){(float)(i % 7) * 3.0f, -(float)(i % 11)};
+
+        if (i % 4 == 0) JBody2D_ApplyForce(BODY, (Vector2){40.0f, -20.0f});
+
+        PREDICTIONS[i] = (JubiPrediction2D){BODY -> Handle, PATHS[i], 0};
+    }
+
+    // Kinematic bodies keep their set velocity & pass through statics, so this one's path goes on through the wall
+    Body2D *PLATFORM = JBody2D_CreateBox(&WORLD, (Vector2){1180, -20}, (Vector2){4, 1}, BODY_KINEMATIC, 1.0f);
+    PLATFORM -> Velocity = (Vector2){30.0f, 5.0f};
+
+    JubiPrediction2D PLATFORM_PREDICTION = {PLATFORM -> Handle, PLATFORM_PATH, 0};
+
+    // A body resting on the floor can't fall any further
+    for (int i=0; i < 30; i++) Jubi_StepWorld2D(&WORLD, 0.016f);
+
+    memcpy(BEFORE, WORLD.Bodies, sizeof(Body2D) * WORLD.BodyCount);
+
+    // Predicting between steps hands its scratch memory back, so asking again doesn't need any more
+    Jubi_PredictPaths2D(&WORLD, PREDICTIONS, PROJECTILES, 0.016f, STEPS, 1);
+    size_t SCRATCH = WORLD.Scratch.HighWater;
+
+    clock_t START = clock();
+    for (int r=0; r < 100; r++) Jubi_PredictPaths2D(&WORLD, PREDICTIONS, PROJECTILES, 0.016f, STEPS, 1);
+    double PREDICT_US = (double)(clock() - START) / CLOCKS_PER_SEC * 1e6 / 100;
+
+    int GREW = WORLD.Scratch.HighWater != SCRATCH;
+
+    Jubi_PredictPaths2D(&WORLD, &PLATFORM_PREDICTION, 1, 0.016f, STEPS, 1);
+
+    int CHANGED = memcmp(BEFORE, WORLD.Bodies, sizeof(Body2D) * WORLD.BodyCount) != 0;
+
+    START = clock();
+
+    for (int r=0; r < 10; r++) {
+        Jubi_CloneWorld2D(&WORLD, &COPY);
+
+        for (int s=0; s < STEPS; s++) Jubi_StepWorld2D(&COPY, 0.016f);
+
+        Jubi_DestroyWorld2D(&COPY);
+    }
+
+    double COPY_US = (double)(clock() - START) / CLOCKS_PER_SEC * 1e6 / 10;
+
+    // A clone owns its own memory & bodies, so it outlives the world it came from & steps the same way
+    JubiWorld2D *SOURCE = (JubiWorld2D *)malloc(sizeof(JubiWorld2D));
+
+    Jubi_CloneWorld2D(&WORLD, SOURCE);
+    Jubi_CloneWorld2D(SOURCE, &COPY);
+    Jubi_DestroyWorld2D(SOURCE);
+    free(SOURCE);
+
+    int FOREIGN_BODIES = 0;
+
+    for (int i=0; i < COPY.BodyCount; i++)
+        FOREIGN_BODIES += COPY.Bodies[i].WORLD != &COPY;
+
+    for (int s=0; s < STEPS; s++) Jubi_StepWorld2D(&COPY, 0.016f);
+
+    int DIVERGED = 0, MISSED = 0, HITS = 0, RESTING = 0, PLATFORM_DIVERGED = 0;
+
+    for (int s=0; s < STEPS; s++) {
+        Jubi_StepWorld2D(&WORLD, 0.016f);
+
+        for (int i=0; i < PROJECTILES; i++) {
+            const Body2D *BODY = Jubi_GetBodyFromHandle2D(&WORLD, PREDICTIONS[i].Handle);
+
+            if (PREDICTIONS[i].HitStep < 0 || s < PREDICTIONS[i].HitStep) {
+                if (BODY -> Position.x != PATHS[i][s].x || BODY -> Position.y != PATHS[i][s].y) DIVERGED++;
+            }
+        }
+
+        const Body2D *BODY = Jubi_GetBodyFromHandle2D(&WORLD, PLATFORM_PREDICTION.Handle);
+        if (BODY -> Position.x != PLATFORM_PATH[s].x || BODY -> Position.y != PLATFORM_PATH[s].y) PLATFORM_DIVERGED++;
+    }
+
+    int CLONE_DIFFERS = COPY.BodyCount != WORLD.BodyCount;
+
+    for (int i=0; i < WORLD.BodyCount && !CLONE_DIFFERS; i++)
+        if (COPY.Bodies[i].Position.x != WORLD.Bodies[i].Position.x || COPY.Bodies[i].Position.y != WORLD.Bodies[i].Position.y) CLONE_DIFFERS = 1;
+
+    Jubi_DestroyWorld2D(&COPY);
+
+    for (int i=0; i < PROJECTILES; i++) {
+        if (PREDICTIONS[i].HitStep < 0) continue;
+
+        HITS++;
+
+        if (PREDICTIONS[i].HitStep == 0) RESTING++;
+
+        // Bodies slide along the floor after landing, but the height they land at should match
+        const Body2D *BODY = Jubi_GetBodyFromHandle2D(&WORLD, PREDICTIONS[i].Handle);
+        if (BODY -> Position.y > 40.0f && fabsf(BODY -> Position.y - PATHS[i][STEPS - 1].y) > 0.5f) MISSED++;
+    }
+
+    printf("World changed by predicting: %s, scratch grew from predicting again: %s\n", CHANGED ? "YES" : "no", GREW ? "YES" : "no");
+    printf("Predictions hitting the room: %d (%d already resting), off the real path before the hit: %d steps, landed at the wrong height: %d\n", HITS, RESTING, DIVERGED, MISSED);
+    printf("Kinematic platform off its real path: %d steps (ends at x = %.1f, %s)\n", PLATFORM_DIVERGED, PLATFORM_PATH[STEPS - 1].x, PLATFORM_PREDICTION.HitStep < 0 ? "through the wall" : "STOPPED BY THE WALL");
+    printf("Clone stepped differently from the world: %s, clone bodies pointing at another world: %d\n", CLONE_DIFFERS ? "YES" : "no", FOREIGN_BODIES);
+    printf("%d bodies x %d steps: %.0f us predicted, %.0f us cloning %d KB of world & stepping it\n", PROJECTILES, STEPS, PREDICT_US, COPY_US, (int)(sizeof(JubiWorld2D) / 1024));
+
+    int PASSED = !CHANGED && !GREW && !CLONE_DIFFERS && FOREIGN_BODIES == 0 && DIVERGED == 0 && MISSED == 0 && HITS > 0 && HITS < PROJECTILES && RESTING > 0 && PLATFORM_DIVERGED == 0 && PLATFORM_PREDICTION.HitStep < 0;
+
+    Jubi_DestroyWorld2D(&WORLD);
+
+    return PASSED ? 0 : 1;
+}
+/*
+
+All source code & software are available under the MIT license:
+    MIT License
+
+    Copyright (c) 2025 Averi
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+
+*/
@@ -0,0 +1,170 @@
+/*
+===========================================================
+                     TEST INFORMATION
+
+TEST NAME: ScratchArena.c
+CREATION DATE: 26/10/18 | International Date Format
+LAST MODIFIED: 26/10/18 | International Date Format
+
+===========================================================
+                      TEST PURPOSE
+
+This test is to check that stepping a settled world does
+not touch the heap. Jubi's allocations are routed through a
+counting allocator, & a pile of boxes is stepped until the
+scratch arena has grown to fit, then counted.
+
+A second world is then given a tiny scratch buffer while
+every allocation fails, & stepped, predicted & cloned, with
+bullets, joints, sensors, force fields, streaming & Morton
+reordering all asking for scratch memory they can't get.
+
+If working correctly, the program should say that the
+measured steps made 0 allocations, & that the starved world
+kept stepping without crashing or losing bodies while the
+prediction & the clone (which needs its own joint pool)
+both failed cleanly.
+
+===========================================================
+                   LICENSE INFORMATION
+
+The following software is protected under the MIT license.
+More detailed information is present at the root LICENSE
+file AND OR the end of the file.
+
+===========================================================
+*/
+
+#include <stdlib.h>
+
+static int Allocations = 0;
+static int Starved = 0; // Every allocation fails
+
+static void *CountedMalloc(size_t SIZE) { Allocations++; return Starved ? NULL : malloc(SIZE); }
+static void *CountedRealloc(void *POINTER, size_t SIZE) { Allocations++; return Starved ? NULL : realloc(POINTER, SIZE); }
+
+#define JUBI_MALLOC(SIZE) CountedMalloc(SIZE)
+#define JUBI_REALLOC(POINTER, SIZE) CountedRealloc((POINTER), (SIZE))
+#define JUBI_FREE(POINTER) free(POINTER)
+
+#define JUBI_IMPLEMENTATION
+#include "../Jubi.h"
+
+#include <stdio.h>
+
+static unsigned char TINY[64];
+static Vector2 PATH[30];
+
+// Steps must carry on when scratch memory runs out, skipping what they can't do rather than writing through NULL
+static int StarvedWorld(void) {
+    static JubiWorld2D WORLD, CLONE;
+    WORLD = Jubi_CreateWorld2D();
+
+    JBody2D_CreateBox(&WORLD, (Vector2){0, 20}, (Vector2){200, 2}, BODY_STATIC, 0.0f);
+
+    for (int i=0; i < 100; i++)
+        JBody2D_CreateBox(&WORLD, (Vector2){(float)(i % 20) * 1.5f - 15.0f, (float)(i / 20) * 1.5f}, (Vector2){1.4f, 1.4f}, BODY_DYNAMIC, 1.0f);
+
+    // Far enough out to be unloaded
+    JBody2D_CreateBox(&WORLD, (Vector2){5000, 0}, (Vector2){1, 1}, BODY_DYNAMIC, 1.0f);
+
+    Body2D *ZONE = JBody2D_CreateBox(&WORLD, (Vector2){0, 10}, (Vector2){40, 10}, BODY_STATIC, 0.0f);
+    JBody2D_SetSensor(ZONE, 1);
+
+    JBody2D_SetBullet(&WORLD.Bodies[1], 1);
+    Jubi_AddJoint2D(&WORLD, JJoint2D_Distance(WORLD.Bodies[2].Handle, WORLD.Bodies[3].Handle, (Vector2){0, 0}, (Vector2){0, 0}, 2.0f));
+    Jubi_AddForceField2D(&WORLD, JForceField2D_Attractor((Vector2){0, 10}, 10.0f, 5.0f));
+
+    Vector2 OBSERVER = {0, 0};
+    Jubi_EnableStreaming2D(&WORLD, 100.0f, 500.0f, 1000.0f);
+    Jubi_SetObservers2D(&WORLD, &OBSERVER, 1);
+
+    WORLD.ReorderInterval = 1;
+
+    Jubi_SetScratchMemory2D(&WORLD, TINY, sizeof(TINY));
+
+    int BODIES = WORLD.BodyCount;
+
+    Starved = 1;
+
+    for (int i=0; i < 60; i++)
+        Jubi_StepWorld2D(&WORLD, 0.016f);
+
+    JubiPrediction2D PREDICTION = {WORLD.Bodies[1].Handle, PATH, 0};
+
+    int PREDICTED = Jubi_PredictPaths2D(&WORLD, &PREDICTION, 1, 0.016f, 30, 1);
+    int CLONED = Jubi_CloneWorld2D(&WORLD, &CLONE);
+
+    Starved = 0;
+
+    // The joint pool is on the heap, so the clone can't get one of its own
+    int PASSED = Jubi_IsWorldValid(&WORLD) == 1 && WORLD.BodyCount == BODIES && PREDICTED == -1 && CLONED == -1;
+
+    printf("Starved world: %d/%d bodies kept, prediction %s, clone %s\n", WORLD.BodyCount, BODIES, PREDICTED == -1 ? "refused" : "RAN", CLONED == -1 ? "refused" : "MADE");
+
+    Jubi_DestroyWorld2D(&CLONE);
+    Jubi_DestroyWorld2D(&WORLD);
+
+    return PASSED;
+}
+
+int main() {
+    static JubiWorld2D WORLD;
+    WORLD = Jubi_CreateWorld2D();
+
+    JBody2D_CreateBox(&WORLD, (Vector2){0, 20}, (Vector2){200, 2}, BODY_STATIC, 0.0f);
+
+    // A loose stack of boxes, so every step has plenty of pairs
+    for (int i=0; i < 400; i++)
+        JBody2D_CreateBox(&WORLD, (Vector2){(float)(i % 40) * 1.5f - 30.0f, (float)(i / 40) * 1.5f}, (Vector2){1.4f, 1.4f}, BODY_DYNAMIC, 1.0f);
+
+    JBody2D_SetBullet(&WORLD.Bodies[1], 1);
+    Jubi_AddForceField2D(&WORLD, JForceField2D_Attractor((Vector2){0, 10}, 10.0f, 5.0f));
+
+    // Warm up, the arena grows here
+    for (int i=0; i < 60; i++)
+        Jubi_StepWorld2D(&WORLD, 0.016f);
+
+    int WARMUP = Allocations;
+    Allocations = 0;
+
+    for (int i=0; i < 600; i++)
+        Jubi_StepWorld2D(&WORLD, 0.016f);
+
+    printf("Warm up allocations: %d\n", WARMUP);
+    printf("Steady state allocations: %d (Arena: %zu bytes, High water: %zu bytes)\n", Allocations, WORLD.Scratch.Capacity, WORLD.Scratch.HighWater);
+
+    Jubi_DestroyWorld2D(&WORLD);
+
+    int PASSED = Allocations == 0;
+    PASSED = StarvedWorld() && PASSED;
+
+    return PASSED ? 0 : 1;
+}
+
+/*
+
+All source code & software are available under the MIT license:
+    MIT License
+
+    Copyright (c) 2025 Averi
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+
+*/
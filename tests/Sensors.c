@@ -0,0 +1,177 @@
+/*
+===========================================================
+                     TEST INFORMATION
+
+TEST NAME: Sensors.c
+CREATION DATE: 26/10/18 | International Date Format
+LAST MODIFIED: 26/10/18 | International Date Format
+
+===========================================================
+                      TEST PURPOSE
+
+This test is to check sensor bodies. A row of crates falls
+through a line of coin sensors onto a floor covered by a
+damage zone sensor, next to a crate that falls onto a solid
+ledge at the same height as the coins. A second world leaves
+a crate frozen by streaming inside a static trap sensor.
+
+If working correctly, the program should say that every coin
+saw its crate pass through without moving or slowing it, the
+solid ledge stopped its crate, & the damage zone reports the
+crates resting on the floor.
+
+===========================================================
+                   LICENSE INFORMATION
+
+The following software is protected under the MIT license.
+More detailed information is present at the root LICENSE
+file AND OR the end of the file.
+
+===========================================================
+*/
+
+#define JUBI_IMPLEMENTATION
+#include "../Jubi.h"
+
+#include <stdio.h>
+
+#define COINS 20
+
+// A frozen body holds still like a static one, but a static sensor over it still has to see it
+static int FrozenInTrap(void) {
+    static JubiWorld2D WORLD;
+
+    WORLD = Jubi_CreateWorld2D();
+
+    Body2D *TRAP = JBody2D_CreateBox(&WORLD, (Vector2){200, 0}, (Vector2){20, 20}, BODY_STATIC, 0.0f);
+    JBody2D_SetSensor(TRAP, 1);
+
+    int TRAP_HANDLE = TRAP -> Handle;
+    int CRATE_HANDLE = JBody2D_CreateBox(&WORLD, (Vector2){200, 0}, (Vector2){1, 1}, BODY_DYNAMIC, 1.0f) -> Handle;
+
+    Vector2 OBSERVER = {0, 0};
+    Jubi_EnableStreaming2D(&WORLD, 100.0f, 50.0f, 1000.0f);
+    Jubi_SetObservers2D(&WORLD, &OBSERVER, 1);
+
+    int SEEN = 0;
+
+    for (int STEP=0; STEP < 10; STEP++) {
+        Jubi_StepWorld2D(&WORLD, 0.016f);
+
+        for (int i=0; i < WORLD.SensorOverlapCount; i++)
+            if (WORLD.SensorOverlaps[i].Sensor == TRAP_HANDLE && WORLD.SensorOverlaps[i].Other == CRATE_HANDLE) SEEN++;
+    }
+
+    const Body2D *CRATE = Jubi_GetBodyFromHandle2D(&WORLD, CRATE_HANDLE);
+    int FROZEN = CRATE != NULL && (CRATE -> Flags & JUBI_BODY_FROZEN) && CRATE -> Position.y == 0.0f;
+
+    printf("Steps the trap saw its frozen crate: %d/10 (crate frozen in place: %s)\n", SEEN, FROZEN ? "yes" : "NO");
+
+    Jubi_DestroyWorld2D(&WORLD);
+
+    return FROZEN && SEEN == 10;
+}
+
+int main() {
+    static JubiWorld2D WORLD;
+
+    WORLD = Jubi_CreateWorld2D();
+
+    JBody2D_CreateBox(&WORLD, (Vector2){0, 20}, (Vector2){200, 2}, BODY_STATIC, 0.0f);
+
+    Body2D *ZONE = JBody2D_CreateBox(&WORLD, (Vector2){0, 17}, (Vector2){200, 4}, BODY_STATIC, 0.0f);
+    JBody2D_SetSensor(ZONE, 1);
+
+    int ZONE_HANDLE = ZONE -> Handle;
+
+    int COIN_HANDLES[COINS], CRATE_HANDLES[COINS];
+    int SEEN[COINS] = {0};
+
+    for (int i=0; i < COINS; i++) {
+        Body2D *COIN = JBody2D_CreateCircle(&WORLD, (Vector2){(float)i * 4.0f - 40.0f, 5.0f}, (Vector2){1.5f, 1.5f}, BODY_STATIC, 0.0f);
+        JBody2D_SetSensor(COIN, 1);
+
+        COIN_HANDLES[i] = COIN -> Handle;
+        CRATE_HANDLES[i] = JBody2D_CreateBox(&WORLD, (Vector2){(float)i * 4.0f - 40.0f, -5.0f}, (Vector2){1.0f, 1.0f}, BODY_DYNAMIC, 1.0f) -> Handle;
+    }
+
+    // The control, a solid ledge where a coin would be
+    JBody2D_CreateBox(&WORLD, (Vector2){50.0f, 5.0f}, (Vector2){1.5f, 1.5f}, BODY_STATIC, 0.0f);
+    int CONTROL = JBody2D_CreateBox(&WORLD, (Vector2){50.0f, -5.0f}, (Vector2){1.0f, 1.0f}, BODY_DYNAMIC, 1.0f) -> Handle;
+
+    int IN_ZONE = 0, BAD = 0;
+
+    for (int STEP=0; STEP < 300; STEP++) {
+        Jubi_StepWorld2D(&WORLD, 0.016f);
+
+        IN_ZONE = 0;
+
+        for (int i=0; i < WORLD.SensorOverlapCount; i++) {
+            JubiSensorOverlap2D OVERLAP = WORLD.SensorOverlaps[i];
+
+            if (OVERLAP.Sensor == ZONE_HANDLE) {
+                IN_ZONE++;
+
+                continue;
+            }
+
+            for (int c=0; c < COINS; c++) {
+                if (OVERLAP.Sensor != COIN_HANDLES[c]) continue;
+
+                if (OVERLAP.Other == CRATE_HANDLES[c]) SEEN[c]++;
+                else BAD++;
+            }
+        }
+    }
+
+    int MISSED = 0, MOVED = 0, LANDED = 0;
+
+    for (int i=0; i < COINS; i++) {
+        const Body2D *COIN = Jubi_GetBodyFromHandle2D(&WORLD, COIN_HANDLES[i]);
+        const Body2D *CRATE = Jubi_GetBodyFromHandle2D(&WORLD, CRATE_HANDLES[i]);
+
+        if (SEEN[i] == 0) MISSED++;
+        if (COIN -> Position.x != (float)i * 4.0f - 40.0f || COIN -> Position.y != 5.0f) MOVED++;
+        if (CRATE -> Position.y > 18.0f && CRATE -> Position.y < 19.1f) LANDED++;
+    }
+
+    float CONTROL_Y = Jubi_GetBodyFromHandle2D(&WORLD, CONTROL) -> Position.y;
+
+    printf("Coins that saw their crate: %d/%d (wrong overlaps: %d), coins moved: %d\n", COINS - MISSED, COINS, BAD, MOVED);
+    printf("Crates on the floor: %d/%d, crate on the ledge at y = %.2f\n", LANDED, COINS, CONTROL_Y);
+    printf("Crates in the damage zone: %d\n", IN_ZONE);
+
+    int PASSED = MISSED == 0 && BAD == 0 && MOVED == 0 && LANDED == COINS && CONTROL_Y < 5.0f && IN_ZONE == COINS;
+
+    Jubi_DestroyWorld2D(&WORLD);
+
+    PASSED = FrozenInTrap() && PASSED;
+
+    return PASSED ? 0 : 1;
+}
+/*
+
+All source code & software are available under the MIT license:
+    MIT License
+
+    Copyright (c) 2025 Averi
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+
+*/
@@ -0,0 +1,152 @@
+/*
+===========================================================
+                     TEST INFORMATION
+
+TEST NAME: ShapePool.c
+CREATION DATE: 26/10/18 | International Date Format
+LAST MODIFIED: 26/10/18 | International Date Format
+
+===========================================================
+                      TEST PURPOSE
+
+This test is to check the shared shape pool. 500 crates &
+500 balls are made from two shapes, asked for again & again,
+& dropped onto a floor.
+
+If working correctly, the program should say that the pool
+wasn't allocated before the first shape, that the world
+holds only the two shapes, that every body's bounds still
+come straight from its shared shape after stepping, that the
+crates & balls landed on the floor, & how much smaller a body
+is without the per-body shape data it used to carry.
+
+===========================================================
+                   LICENSE INFORMATION
+
+The following software is protected under the MIT license.
+More detailed information is present at the root LICENSE
+file AND OR the end of the file.
+
+===========================================================
+*/
+
+#define JUBI_IMPLEMENTATION
+#include "../Jubi.h"
+
+#include <stdio.h>
+
+#define EACH 500
+
+// Body2D as it was while every body carried its own copy of its shape's AABB / circle
+typedef struct {
+    Vector2 Position;
+    Vector2 Velocity;
+    Vector2 _Size;
+
+    Shape2D Shape;
+    BodyType2D Type;
+
+    Vector2 Force;
+    Vector2 AccumulatedForce;
+
+    float Mass;
+    float InvMass;
+    float Restitution;
+    float Friction;
+
+    union {
+        AABB _AABB;
+        Circle2D Circle;
+    } ShapeData;
+
+    AABB Bounds;
+
+    JUBI_UINT32 Flags;
+
+    int Tier;
+    float _Skipped;
+    int _ContactTier;
+
+    int ShapeId;
+
+    int Index;
+    int Handle;
+    JubiWorld2D *WORLD;
+
+    void *UserData;
+} Body2DWithShapeData;
+
+int main() {
+    static JubiWorld2D WORLD;
+    WORLD = Jubi_CreateWorld2D();
+
+    JBody2D_CreateBox(&WORLD, (Vector2){0, 40}, (Vector2){400, 2}, BODY_STATIC, 0.0f);
+
+    // Worlds that never use shapes don't pay for the pool
+    int EARLY_POOL = WORLD.Shapes != NULL;
+
+    int SHARED = 1;
+
+    for (int i=0; i < EACH; i++) {
+        // Identical geometry gives back the shape that's already there
+        int CRATE = Jubi_CreateShape2D(&WORLD, SHAPE_BOX, (Vector2){1.0f, 1.0f});
+        int BALL = Jubi_CreateShape2D(&WORLD, SHAPE_CIRCLE, (Vector2){0.8f, 0.8f});
+
+        if (CRATE != 0 || BALL != 1) SHARED = 0;
+
+        JBody2D_CreateFromShape(&WORLD, (Vector2){(float)(i % 100) * 2.0f - 100.0f, (float)(i / 100) * 2.0f}, CRATE, BODY_DYNAMIC, 1.0f);
+        JBody2D_CreateFromShape(&WORLD, (Vector2){(float)(i % 100) * 2.0f - 99.0f, (float)(i / 100) * 2.0f - 12.0f}, BALL, BODY_DYNAMIC, 1.0f);
+    }
+
+    for (int STEP=0; STEP < 300; STEP++)
+        Jubi_StepWorld2D(&WORLD, 0.016f);
+
+    int FROM_SHAPE = 0, LANDED = 0;
+
+    for (int i=0; i < WORLD.BodyCount; i++) {
+        const Body2D *BODY = &WORLD.Bodies[i];
+        if (BODY -> ShapeId < 0) continue;
+
+        Vector2 HALF = WORLD.Shapes[BODY -> ShapeId].HalfSize;
+
+        if (BODY -> Bounds.Min.x == BODY -> Position.x - HALF.x && BODY -> Bounds.Max.y == BODY -> Position.y + HALF.y) FROM_SHAPE++;
+        if (BODY -> Bounds.Max.y > 30.0f && BODY -> Bounds.Max.y < 39.1f) LANDED++;
+    }
+
+    printf("Pool allocated before the first shape: %s, world: %d KB\n", EARLY_POOL ? "YES" : "no", (int)(sizeof(JubiWorld2D) / 1024));
+    printf("Shapes in the pool: %d (every request shared: %s)\n", WORLD.ShapeCount, SHARED ? "yes" : "NO");
+    printf("Bodies with bounds from their shared shape: %d/%d, landed on the floor: %d/%d\n", FROM_SHAPE, EACH * 2, LANDED, EACH * 2);
+    printf("Body2D: %d bytes, %d with per-body shape data (%d bytes saved over %d bodies)\n", (int)sizeof(Body2D), (int)sizeof(Body2DWithShapeData), (int)((sizeof(Body2DWithShapeData) - sizeof(Body2D)) * EACH * 2), EACH * 2);
+
+    int PASSED = !EARLY_POOL && WORLD.ShapeCount == 2 && SHARED && FROM_SHAPE == EACH * 2 && LANDED == EACH * 2 && sizeof(Body2D) < sizeof(Body2DWithShapeData);
+
+    Jubi_DestroyWorld2D(&WORLD);
+
+    return PASSED ? 0 : 1;
+}
+/*
+
+All source code & software are available under the MIT license:
+    MIT License
+
+    Copyright (c) 2025 Averi
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+
+*/
@@ -0,0 +1,210 @@
+/*
+===========================================================
+                     TEST INFORMATION
+
+TEST NAME: Streaming.c
+CREATION DATE: 26/10/18 | International Date Format
+LAST MODIFIED: 26/10/18 | International Date Format
+
+===========================================================
+                      TEST PURPOSE
+
+This test is to check world streaming. A level of 200
+floors with 20 crates each (4200 bodies, far more than
+JUBI_MAX_BODIES) is streamed into a world while an observer
+walks from one end to the other & back.
+
+If working correctly, the program should say that the world
+never overflowed, no body was lost, frozen crates held still,
+& every crate came back where it was unloaded.
+
+===========================================================
+                   LICENSE INFORMATION
+
+The following software is protected under the MIT license.
+More detailed information is present at the root LICENSE
+file AND OR the end of the file.
+
+===========================================================
+*/
+
+#define JUBI_IMPLEMENTATION
+#include "../Jubi.h"
+
+#include <stdio.h>
+#include <stdint.h>
+
+#define FLOORS 200
+#define CRATES_PER_FLOOR 20
+#define FLOOR_WIDTH 20.0f
+#define TOTAL (FLOORS * (CRATES_PER_FLOOR + 1))
+
+static Vector2 UNLOADED_AT[FLOORS * CRATES_PER_FLOOR];
+static int LOADS = 0;
+static int MISPLACED = 0;
+
+static void OnStream(void *CONTEXT, Body2D *BODY, int LOADED) {
+    (void)CONTEXT;
+
+    if (BODY -> UserData == NULL) return;
+
+    int CRATE = (int)(intptr_t)BODY -> UserData - 1;
+
+    if (!LOADED) {
+        UNLOADED_AT[CRATE] = BODY -> Position;
+
+        return;
+    }
+
+    LOADS++;
+
+    if (JVector2_Distance(UNLOADED_AT[CRATE], BODY -> Position) > 0.0001f) MISPLACED++;
+}
+
+static int CALLBACKS = 0;
+
+static void CountStream(void *CONTEXT, Body2D *BODY, int LOADED) {
+    (void)CONTEXT; (void)BODY; (void)LOADED;
+
+    CALLBACKS++;
+}
+
+// Two bodies in opposite corners of one chunk, with the observer in the middle. The chunk's bounds reach the observer but neither body is within the load radius, so nothing should load.
+static int CornerChurn(void) {
+    static JubiWorld2D CORNERS;
+    CORNERS = Jubi_CreateWorld2D();
+
+    Vector2 OBSERVER = {50, 50};
+
+    Jubi_SetObservers2D(&CORNERS, &OBSERVER, 1);
+    Jubi_EnableStreaming2D(&CORNERS, 100.0f, 10.0f, 20.0f);
+
+    CORNERS.Streaming.OnStream = CountStream;
+
+    Body2D A = JBody2D_Init((Vector2){5, 5}, (Vector2){1, 1}, SHAPE_BOX, BODY_STATIC, 0.0f);
+    Body2D B = JBody2D_Init((Vector2){95, 95}, (Vector2){1, 1}, SHAPE_BOX, BODY_STATIC, 0.0f);
+
+    Jubi_StreamBody2D(&CORNERS, &A);
+    Jubi_StreamBody2D(&CORNERS, &B);
+
+    for (int i=0; i < 100; i++) Jubi_StepWorld2D(&CORNERS, 0.016f);
+
+    int STILL_STORED = CORNERS.BodyCount == 0 && CORNERS.Streaming.Unloaded == 2;
+
+    Jubi_DestroyWorld2D(&CORNERS);
+
+    return STILL_STORED ? CALLBACKS : -1;
+}
+
+int main() {
+    static JubiWorld2D WORLD;
+    WORLD = Jubi_CreateWorld2D();
+
+    Vector2 OBSERVER = {0, 0};
+
+    Jubi_SetObservers2D(&WORLD, &OBSERVER, 1);
+    Jubi_EnableStreaming2D(&WORLD, 50.0f, 40.0f, 100.0f);
+
+    WORLD.Streaming.OnStream = OnStream;
+
+    for (int f=0; f < FLOORS; f++) {
+        float LEFT = (float)f * FLOOR_WIDTH;
+
+        Body2D FLOOR = JBody2D_Init((Vector2){LEFT + FLOOR_WIDTH * 0.5f, 10.0f}, (Vector2){FLOOR_WIDTH, 2.0f}, SHAPE_BOX, BODY_STATIC, 0.0f);
+        Jubi_StreamBody2D(&WORLD, &FLOOR);
+
+        for (int c=0; c < CRATES_PER_FLOOR; c++) {
+            int CRATE = f * CRATES_PER_FLOOR + c;
+
+            Body2D BOX = JBody2D_Init((Vector2){LEFT + (float)c + 0.5f, 8.55f}, (Vector2){0.8f, 0.8f}, SHAPE_BOX, BODY_DYNAMIC, 1.0f);
+            BOX.UserData = (void *)(intptr_t)(CRATE + 1);
+
+            UNLOADED_AT[CRATE] = BOX.Position;
+
+            Jubi_StreamBody2D(&WORLD, &BOX);
+        }
+    }
+
+    int MOST = 0;
+    int LOST = 0;
+    int DRIFTED = 0;
+
+    // Where each crate was before the step, its unload position while it's out of the world
+    static Vector2 BEFORE[FLOORS * CRATES_PER_FLOOR];
+
+    float END = (float)FLOORS * FLOOR_WIDTH;
+
+    // Out & back at 10 units a step
+    for (int STEP=0; STEP <= 800; STEP++) {
+        float WALKED = (float)STEP * 10.0f;
+
+        OBSERVER.x = WALKED <= END ? WALKED : 2.0f * END - WALKED;
+        Jubi_SetObservers2D(&WORLD, &OBSERVER, 1);
+
+        for (int i=0; i < FLOORS * CRATES_PER_FLOOR; i++)
+            BEFORE[i] = UNLOADED_AT[i];
+
+        for (int i=0; i < WORLD.BodyCount; i++) {
+            if (WORLD.Bodies[i].UserData) BEFORE[(intptr_t)WORLD.Bodies[i].UserData - 1] = WORLD.Bodies[i].Position;
+        }
+
+        Jubi_StepWorld2D(&WORLD, 0.016f);
+
+        // Bodies move around the array as others unload, so crates are matched by UserData
+        for (int i=0; i < WORLD.BodyCount; i++) {
+            Body2D *BODY = &WORLD.Bodies[i];
+
+            if (BODY -> UserData && (BODY -> Flags & JUBI_BODY_FROZEN) && JVector2_Distance(BEFORE[(intptr_t)BODY -> UserData - 1], BODY -> Position) > 0.0f) DRIFTED++;
+        }
+
+        if (WORLD.BodyCount > MOST) MOST = WORLD.BodyCount;
+        if (WORLD.BodyCount + WORLD.Streaming.Unloaded != TOTAL) LOST++;
+    }
+
+    int FELL = 0;
+
+    for (int i=0; i < WORLD.BodyCount; i++) {
+        if (WORLD.Bodies[i].Type == BODY_DYNAMIC && WORLD.Bodies[i].Bounds.Max.y > 9.01f) FELL++;
+    }
+
+    printf("Most bodies in the world: %d of %d (limit %d)\n", MOST, TOTAL, JUBI_MAX_BODIES);
+    printf("Steps with bodies missing: %d\n", LOST);
+    printf("Frozen crates that moved: %d\n", DRIFTED);
+    printf("Crates loaded back: %d, in the wrong place: %d, through the floor: %d\n", LOADS, MISPLACED, FELL);
+
+    int CHURN = CornerChurn();
+
+    printf("Far bodies in a chunk reaching the observer, loads & unloads over 100 steps: %d\n", CHURN);
+
+    int PASSED = MOST <= JUBI_MAX_BODIES && LOST == 0 && DRIFTED == 0 && LOADS > 0 && MISPLACED == 0 && FELL == 0 && CHURN == 0;
+
+    Jubi_DestroyWorld2D(&WORLD);
+
+    return PASSED ? 0 : 1;
+}
+/*
+
+All source code & software are available under the MIT license:
+    MIT License
+
+    Copyright (c) 2025 Averi
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+
+*/
@@ -0,0 +1,103 @@
+/*
+===========================================================
+                     TEST INFORMATION
+
+TEST NAME: TemplateWorld.cpp
+CREATION DATE: 26/10/18 | International Date Format
+LAST MODIFIED: 26/10/18 | International Date Format
+
+===========================================================
+                      TEST PURPOSE
+
+This test is to check the C++ layer in Jubi.hpp. A boxes
+only World2D (no force fields, CCD or polygons) is stepped
+next to a plain C world with the same bodies, stepped with
+the same features through Jubi_StepWorld2DEx. The template
+world's capacity limit is also checked.
+
+If working correctly, the program should say that both
+worlds match & that the full world refused the extra box.
+
+===========================================================
+                   LICENSE INFORMATION
+
+The following software is protected under the MIT license.
+More detailed information is present at the root LICENSE
+file AND OR the end of the file.
+
+===========================================================
+*/
+
+#define JUBI_IMPLEMENTATION
+#include "../Jubi.hpp"
+
+#include <stdio.h>
+
+typedef Jubi::World2D<64, 0> BoxWorld;
+
+static BoxWorld TEMPLATED;
+static JubiWorld2D PLAIN;
+
+int main() {
+    PLAIN = Jubi_CreateWorld2D();
+
+    TEMPLATED.CreateBox({0, 20}, {100, 2}, BODY_STATIC, 0.0f);
+    JBody2D_CreateBox(&PLAIN, {0, 20}, {100, 2}, BODY_STATIC, 0.0f);
+
+    for (int i=0; i < 63; i++) {
+        Vector2 POSITION = {(float)(i % 9) * 1.5f - 6.0f, (float)(i / 9) * 1.5f};
+
+        TEMPLATED.CreateBox(POSITION, {1.4f, 1.4f}, BODY_DYNAMIC, 1.0f);
+        JBody2D_CreateBox(&PLAIN, POSITION, {1.4f, 1.4f}, BODY_DYNAMIC, 1.0f);
+    }
+
+    int EXTRA = TEMPLATED.CreateBox({0, 0}, {1, 1}, BODY_DYNAMIC, 1.0f);
+
+    for (int i=0; i < 240; i++) {
+        TEMPLATED.Step(0.016f);
+        Jubi_StepWorld2DEx(&PLAIN, 0.016f, 0);
+    }
+
+    int MISMATCHES = 0;
+
+    for (int i=0; i < PLAIN.BodyCount; i++) {
+        const Body2D *A = &TEMPLATED.C() -> Bodies[i];
+        const Body2D *B = &PLAIN.Bodies[i];
+
+        MISMATCHES += A -> Position.x != B -> Position.x || A -> Position.y != B -> Position.y;
+    }
+
+    printf("Bodies: %d / %d, Extra box handle: %d\n", TEMPLATED.BodyCount(), BoxWorld::MaxBodies, EXTRA);
+    printf("Template & C worlds: %s\n", MISMATCHES == 0 ? "Match" : "DIFFER");
+
+    Jubi_DestroyWorld2D(&PLAIN);
+
+    return (MISMATCHES == 0 && EXTRA == JUBI_INVALID_HANDLE) ? 0 : 1;
+}
+
+/*
+
+All source code & software are available under the MIT license:
+    MIT License
+
+    Copyright (c) 2025 Averi
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+
+*/
@@ -0,0 +1,128 @@
+/*
+===========================================================
+                     TEST INFORMATION
+
+TEST NAME: Tilemap.c
+CREATION DATE: 26/10/18 | International Date Format
+LAST MODIFIED: 26/10/18 | International Date Format
+
+===========================================================
+                      TEST PURPOSE
+
+This test is to check the tilemap collider. A 500x500 tile
+level (far more tiles than JUBI_MAX_BODIES) has a long
+floor & a wall. Boxes slide along the floor, over the
+tile seams, into the wall. Another box lands fast right on
+a seam, & one more drops into a one tile wide pit.
+
+If working correctly, the program should say that the
+boxes slid without snagging & piled up at the wall, that
+the seam box landed straight down, & that the dropped box
+sits at the bottom of the pit.
+
+===========================================================
+                   LICENSE INFORMATION
+
+The following software is protected under the MIT license.
+More detailed information is present at the root LICENSE
+file AND OR the end of the file.
+
+===========================================================
+*/
+
+#define JUBI_IMPLEMENTATION
+#include "../Jubi.h"
+
+#include <stdio.h>
+
+#define MAP_SIZE 500
+
+static JUBI_UINT8 LEVEL[MAP_SIZE * MAP_SIZE];
+
+int main() {
+    static JubiWorld2D WORLD;
+    WORLD = Jubi_CreateWorld2D();
+
+    // Floor along row 20, a wall at column 220, & a 1 tile pit at column 100 down to row 22
+    for (int x=0; x < MAP_SIZE; x++) LEVEL[20 * MAP_SIZE + x] = 1;
+    for (int y=0; y < 20; y++) LEVEL[y * MAP_SIZE + 220] = 1;
+
+    LEVEL[20 * MAP_SIZE + 100] = 0;
+    LEVEL[21 * MAP_SIZE + 100] = 0;
+    for (int y=21; y <= 22; y++) { LEVEL[y * MAP_SIZE + 99] = 1; LEVEL[y * MAP_SIZE + 101] = 1; }
+    LEVEL[22 * MAP_SIZE + 100] = 1;
+
+    int MAP = Jubi_CreateTilemap2D(&WORLD, MAP_SIZE, MAP_SIZE, 1.0f, (Vector2){0, 0});
+    Jubi_SetTiles2D(&WORLD, MAP, LEVEL);
+
+    Body2D *SLIDERS[3];
+
+    for (int i=0; i < 3; i++) {
+        SLIDERS[i] = JBody2D_CreateBox(&WORLD, (Vector2){150.0f + (float)i * 3.0f, 19.4f}, (Vector2){1.2f, 1.2f}, BODY_DYNAMIC, 1.0f);
+        SLIDERS[i] -> Velocity.x = 60.0f;
+    }
+
+    // Lands fast, just barely over the seam between tiles 120 & 121
+    Body2D *LANDING = JBody2D_CreateBox(&WORLD, (Vector2){120.42f, 2.1f}, (Vector2){1.2f, 1.2f}, BODY_DYNAMIC, 1.0f);
+    LANDING -> Velocity.y = 30.0f;
+
+    Body2D *FALLING = JBody2D_CreateBox(&WORLD, (Vector2){100.5f, 10.0f}, (Vector2){0.8f, 0.8f}, BODY_DYNAMIC, 1.0f);
+
+    int SNAGGED = 0;
+
+    for (int i=0; i < 240; i++) {
+        float SPEED = SLIDERS[2] -> Velocity.x;
+
+        Jubi_StepWorld2D(&WORLD, 0.016f);
+
+        // Before the wall, the lead box should only ever slow down from drag
+        if (SLIDERS[2] -> Bounds.Max.x < 219.0f && SLIDERS[2] -> Velocity.x < SPEED * (1.0f - AIR_RESISTANCE) - 0.001f) SNAGGED++;
+    }
+
+    int RESTING = 1;
+
+    for (int i=0; i < 3; i++) {
+        printf("Box %d: (%f, %f)\n", i, SLIDERS[i] -> Position.x, SLIDERS[i] -> Position.y);
+
+        RESTING &= fabsf(SLIDERS[i] -> Bounds.Max.y - 20.0f) < 0.01f && SLIDERS[i] -> Bounds.Max.x <= 220.001f;
+    }
+
+    printf("Seam box: (%f, %f), expected x 120.42\n", LANDING -> Position.x, LANDING -> Position.y);
+    printf("Pit box: (%f, %f)\n", FALLING -> Position.x, FALLING -> Position.y);
+    printf("Snagged steps: %d\n", SNAGGED);
+    printf("Tile memory: %d bytes, as static bodies: %d bytes\n", MAP_SIZE * MAP_SIZE, (int)(MAP_SIZE * 21 * sizeof(Body2D)));
+
+    int IN_PIT = fabsf(FALLING -> Bounds.Max.y - 22.0f) < 0.01f;
+    int ON_SEAM = fabsf(LANDING -> Position.x - 120.42f) < 0.001f && fabsf(LANDING -> Bounds.Max.y - 20.0f) < 0.01f;
+
+    Jubi_DestroyWorld2D(&WORLD);
+
+    return (SNAGGED == 0 && RESTING && IN_PIT && ON_SEAM) ? 0 : 1;
+}
+
+/*
+
+All source code & software are available under the MIT license:
+    MIT License
+
+    Copyright (c) 2025 Averi
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+
+*/
@@ -0,0 +1,125 @@
+/*
+===========================================================
+                     TEST INFORMATION
+
+TEST NAME: TransformOutput.c
+CREATION DATE: 26/10/18 | International Date Format
+LAST MODIFIED: 26/10/18 | International Date Format
+
+===========================================================
+                      TEST PURPOSE
+
+This test is to check the transform triple buffer. A world
+is stepped on its async thread, gaining a box before every
+step, while the main thread reads transform frames as fast
+as it can.
+
+If working correctly, the program should say that frames
+were read while steps ran, that no frame was older than one
+read before it, & that every frame held exactly the bodies
+the world had on that step, each handle once.
+
+===========================================================
+                   LICENSE INFORMATION
+
+The following software is protected under the MIT license.
+More detailed information is present at the root LICENSE
+file AND OR the end of the file.
+
+===========================================================
+*/
+
+#define JUBI_ENABLE_THREADS
+#define JUBI_IMPLEMENTATION
+#include "../Jubi.h"
+
+#include <stdio.h>
+
+#define STEPS 300
+#define START_BODIES 400
+
+static int SEEN[JUBI_MAX_BODIES]; // Last frame read that held each handle
+
+int main() {
+    static JubiWorld2D WORLD;
+    WORLD = Jubi_CreateWorld2D();
+
+    JBody2D_CreateBox(&WORLD, (Vector2){0, 20}, (Vector2){200, 2}, BODY_STATIC, 0.0f);
+
+    for (int i=1; i < START_BODIES; i++)
+        JBody2D_CreateBox(&WORLD, (Vector2){(float)(i % 40) * 1.5f - 30.0f, (float)(i / 40) * -1.5f}, (Vector2){1.4f, 1.4f}, BODY_DYNAMIC, 1.0f);
+
+    int BEFORE_ENABLE = Jubi_AcquireTransforms2D(&WORLD) != NULL;
+
+    Jubi_EnableTransformOutput2D(&WORLD, 1);
+
+    long READS = 0;
+    int STEPS_SEEN = 0, BACKWARDS = 0, WRONG_COUNT = 0, BAD_HANDLES = 0;
+    JUBI_UINT64 LAST_STEP = 0;
+
+    for (int i=0; i < STEPS; i++) {
+        // Bodies only change between steps, so a frame from step S holds START_BODIES + S of them
+        JBody2D_CreateBox(&WORLD, (Vector2){(float)(i % 40) * 1.5f - 30.0f, -40.0f - (float)(i / 40) * 1.5f}, (Vector2){1.4f, 1.4f}, BODY_DYNAMIC, 1.0f);
+
+        JubiStepFence2D FENCE = Jubi_StepWorld2DAsync(&WORLD, 0.016f);
+
+        do {
+            const JubiTransformFrame2D *FRAME = Jubi_AcquireTransforms2D(&WORLD);
+            READS++;
+
+            if (FRAME -> Step < LAST_STEP) BACKWARDS++;
+            if (FRAME -> Step > LAST_STEP) STEPS_SEEN++;
+
+            LAST_STEP = FRAME -> Step;
+
+            if (FRAME -> Count != START_BODIES + (int)FRAME -> Step) WRONG_COUNT++;
+
+            for (int j=0; j < FRAME -> Count && j < JUBI_MAX_BODIES; j++) {
+                int HANDLE = FRAME -> Transforms[j].Handle;
+
+                if (HANDLE < 0 || HANDLE >= FRAME -> Count || SEEN[HANDLE] == READS) BAD_HANDLES++;
+                else SEEN[HANDLE] = (int)READS;
+            }
+        } while (!Jubi_PollStep2D(FENCE));
+
+        Jubi_WaitStep2D(FENCE);
+    }
+
+    const JubiTransformFrame2D *LAST = Jubi_AcquireTransforms2D(&WORLD);
+
+    printf("Frame before output was enabled: %s\n", BEFORE_ENABLE ? "RETURNED" : "none");
+    printf("Frames read: %ld, steps seen while stepping: %d of %d, last frame from step %d of %d\n", READS, STEPS_SEEN, STEPS, (int)LAST -> Step, STEPS);
+    printf("Frames older than the one before: %d, with the wrong count: %d, bad or repeated handles: %d\n", BACKWARDS, WRONG_COUNT, BAD_HANDLES);
+
+    int PASSED = !BEFORE_ENABLE && READS >= STEPS && STEPS_SEEN > 0 && BACKWARDS == 0 && WRONG_COUNT == 0 && BAD_HANDLES == 0 && LAST -> Step == STEPS && LAST -> Count == START_BODIES + STEPS;
+
+    Jubi_DestroyWorld2D(&WORLD);
+
+    return PASSED ? 0 : 1;
+}
+/*
+
+All source code & software are available under the MIT license:
+    MIT License
+
+    Copyright (c) 2025 Averi
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+
+*/
@@ -0,0 +1,140 @@
+/*
+===========================================================
+                     TEST INFORMATION
+
+TEST NAME: VectorArrays.c
+CREATION DATE: 26/10/18 | International Date Format
+LAST MODIFIED: 26/10/18 | International Date Format
+
+===========================================================
+                      TEST PURPOSE
+
+This test is to check that the JVector2_*Array functions
+give the same results as calling the single vector
+functions one at a time. A list of vectors with an odd
+length (so the non-SIMD tail runs too), including zero
+length vectors, is run through every array function.
+
+If working correctly, the program should say that every
+function matches.
+
+===========================================================
+                   LICENSE INFORMATION
+
+The following software is protected under the MIT license.
+More detailed information is present at the root LICENSE
+file AND OR the end of the file.
+
+===========================================================
+*/
+
+#define JUBI_IMPLEMENTATION
+#include "../Jubi.h"
+
+#include <stdio.h>
+
+#define VECTOR_COUNT 1003
+
+static Vector2 A[VECTOR_COUNT];
+static Vector2 B[VECTOR_COUNT];
+static Vector2 VECTORS[VECTOR_COUNT];
+static float SCALARS[VECTOR_COUNT];
+
+static int Report(const char *NAME, int MISMATCHES) {
+    printf("%-10s %s\n", NAME, MISMATCHES == 0 ? "Matches" : "DIFFERS");
+
+    return MISMATCHES != 0;
+}
+
+int main() {
+    for (int i=0; i < VECTOR_COUNT; i++) {
+        A[i] = (Vector2){(float)((i * 37) % 101) - 50.0f, (float)((i * 53) % 89) * 0.25f - 11.0f};
+        B[i] = (Vector2){(float)((i * 17) % 23) - 11.5f, (float)((i * 29) % 31) * 0.5f};
+    }
+
+    // Zero length vectors, inside the SIMD blocks & in the tail
+    A[5] = A[6] = A[VECTOR_COUNT - 1] = (Vector2){0, 0};
+    B[6] = A[6];
+
+    int FAILED = 0;
+    int MISMATCHES;
+
+    JVector2_AddArray(A, B, VECTORS, VECTOR_COUNT);
+    MISMATCHES = 0;
+    for (int i=0; i < VECTOR_COUNT; i++) { Vector2 R = JVector2_Add(A[i], B[i]); MISMATCHES += R.x != VECTORS[i].x || R.y != VECTORS[i].y; }
+    FAILED += Report("Add", MISMATCHES);
+
+    JVector2_SubtractArray(A, B, VECTORS, VECTOR_COUNT);
+    MISMATCHES = 0;
+    for (int i=0; i < VECTOR_COUNT; i++) { Vector2 R = JVector2_Subtract(A[i], B[i]); MISMATCHES += R.x != VECTORS[i].x || R.y != VECTORS[i].y; }
+    FAILED += Report("Subtract", MISMATCHES);
+
+    JVector2_ScaleArray(A, 0.3f, VECTORS, VECTOR_COUNT);
+    MISMATCHES = 0;
+    for (int i=0; i < VECTOR_COUNT; i++) { Vector2 R = JVector2_Scale(A[i], 0.3f); MISMATCHES += R.x != VECTORS[i].x || R.y != VECTORS[i].y; }
+    FAILED += Report("Scale", MISMATCHES);
+
+    JVector2_DotArray(A, B, SCALARS, VECTOR_COUNT);
+    MISMATCHES = 0;
+    for (int i=0; i < VECTOR_COUNT; i++) MISMATCHES += JVector2_Dot(A[i], B[i]) != SCALARS[i];
+    FAILED += Report("Dot", MISMATCHES);
+
+    JVector2_LengthArray(A, SCALARS, VECTOR_COUNT);
+    MISMATCHES = 0;
+    for (int i=0; i < VECTOR_COUNT; i++) MISMATCHES += JVector2_Length(A[i]) != SCALARS[i];
+    FAILED += Report("Length", MISMATCHES);
+
+    JVector2_DistanceArray(A, B, SCALARS, VECTOR_COUNT);
+    MISMATCHES = 0;
+    for (int i=0; i < VECTOR_COUNT; i++) MISMATCHES += JVector2_Distance(A[i], B[i]) != SCALARS[i];
+    FAILED += Report("Distance", MISMATCHES);
+
+    // In place, OUT is allowed to alias the input
+    for (int i=0; i < VECTOR_COUNT; i++) VECTORS[i] = A[i];
+
+    JVector2_NormalizeArray(VECTORS, VECTORS, VECTOR_COUNT);
+    MISMATCHES = 0;
+
+    for (int i=0; i < VECTOR_COUNT; i++) {
+        Vector2 R = JVector2_Normalize(A[i]);
+
+        #if defined(JUBI_FAST_RSQRT) || defined(JUBI_SIMD_NEON)
+            MISMATCHES += fabsf(R.x - VECTORS[i].x) > 1e-5f || fabsf(R.y - VECTORS[i].y) > 1e-5f;
+        #else
+            MISMATCHES += R.x != VECTORS[i].x || R.y != VECTORS[i].y;
+        #endif
+    }
+
+    FAILED += Report("Normalize", MISMATCHES);
+
+    printf("Zero vector normalized: (%f, %f)\n", VECTORS[5].x, VECTORS[5].y);
+
+    return FAILED == 0 ? 0 : 1;
+}
+
+/*
+
+All source code & software are available under the MIT license:
+    MIT License
+
+    Copyright (c) 2025 Averi
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+
+*/
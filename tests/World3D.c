@@ -0,0 +1,158 @@
+/*
+===========================================================
+                     TEST INFORMATION
+
+TEST NAME: World3D.c
+CREATION DATE: 26/10/18 | International Date Format
+LAST MODIFIED: 26/10/18 | International Date Format
+
+===========================================================
+                      TEST PURPOSE
+
+This test is to check the 3D world. 1,000 boxes & spheres are
+dropped in columns onto a static floor & stepped for 10
+seconds, then half of them are destroyed & the world is
+queried.
+
+If working correctly, the program should say that every body
+came to rest on or above the floor without any NaNs, that the
+query found the same bodies as checking each one by hand, that
+every handle still pointed at its own body after destroying,
+& how long a step took.
+
+===========================================================
+                   LICENSE INFORMATION
+
+The following software is protected under the MIT license.
+More detailed information is present at the root LICENSE
+file AND OR the end of the file.
+
+===========================================================
+*/
+
+#define JUBI_IMPLEMENTATION
+#include "../Jubi.h"
+
+#include <stdio.h>
+#include <time.h>
+
+#define COLUMNS 10
+#define HEIGHT 10
+#define STEPS 600
+
+static int HANDLES[COLUMNS * COLUMNS * HEIGHT];
+static int IDS[COLUMNS * COLUMNS * HEIGHT];
+static int FOUND[JUBI_MAX_BODIES];
+
+int main() {
+    static JubiWorld3D WORLD;
+
+    WORLD = Jubi_CreateWorld3D();
+
+    // +y is down, like the 2D world
+    int FLOOR = JBody3D_CreateBox(&WORLD, JVector3(0, 50, 0), JVector3(100, 2, 100), BODY_STATIC, 0.0f);
+
+    int BODIES = 0;
+
+    for (int x=0; x < COLUMNS; x++) {
+        for (int z=0; z < COLUMNS; z++) {
+            for (int y=0; y < HEIGHT; y++) {
+                Vector3 POSITION = JVector3((float)x * 3.0f - 15.0f, 46.0f - (float)y * 1.5f, (float)z * 3.0f - 15.0f);
+
+                int HANDLE = (x + y + z) % 2 ? JBody3D_CreateSphere(&WORLD, POSITION, 0.5f, BODY_DYNAMIC, 1.0f) : JBody3D_CreateBox(&WORLD, POSITION, JVector3(1, 1, 1), BODY_DYNAMIC, 2.0f);
+
+                IDS[BODIES] = BODIES;
+                WORLD.UserData[Jubi_GetBodyIndex3D(&WORLD, HANDLE)] = &IDS[BODIES];
+                HANDLES[BODIES++] = HANDLE;
+            }
+        }
+    }
+
+    clock_t START = clock();
+    for (int s=0; s < STEPS; s++) Jubi_StepWorld3D(&WORLD, 0.016f);
+    double STEP_US = (double)(clock() - START) / CLOCKS_PER_SEC * 1e6 / STEPS;
+
+    // The floor's top is at y = 49, a body centre can't be lower than 49 minus its half size
+    int SUNK = 0, INVALID = 0;
+    float FASTEST = 0.0f;
+
+    for (int i=0; i < BODIES; i++) {
+        Vector3 POSITION = JBody3D_GetPosition(&WORLD, HANDLES[i]);
+        Vector3 VELOCITY = JBody3D_GetVelocity(&WORLD, HANDLES[i]);
+
+        if (POSITION.x != POSITION.x || POSITION.y != POSITION.y || POSITION.z != POSITION.z) INVALID++;
+        else if (POSITION.y > 48.5f + 0.05f) SUNK++;
+
+        if (JVector3_Length(VELOCITY) > FASTEST) FASTEST = JVector3_Length(VELOCITY);
+    }
+
+    // Destroy every other body, the rest must keep their handles
+    for (int i=0; i < BODIES; i += 2) JBody3D_Destroy(&WORLD, HANDLES[i]);
+
+    int WRONG = JBody3D_Destroy(&WORLD, HANDLES[0]) != -1;
+
+    for (int i=1; i < BODIES; i += 2) {
+        int INDEX = Jubi_GetBodyIndex3D(&WORLD, HANDLES[i]);
+
+        if (INDEX < 0 || WORLD.UserData[INDEX] != &IDS[i]) WRONG++;
+    }
+
+    for (int s=0; s < 10; s++) Jubi_StepWorld3D(&WORLD, 0.016f);
+
+    AABB3D AREA = {JVector3(-10, 44, -10), JVector3(4, 60, 4)};
+
+    int COUNT = Jubi_QueryAABB3D(&WORLD, AREA, FOUND, JUBI_MAX_BODIES);
+    int EXPECTED = 0, MISMATCHED = 0;
+
+    for (int i=0; i < WORLD.BodyCount; i++) {
+        int INSIDE = WORLD.PositionX[i] + WORLD.HalfX[i] > AREA.Min.x && WORLD.PositionX[i] - WORLD.HalfX[i] < AREA.Max.x &&
+                     WORLD.PositionY[i] + WORLD.HalfY[i] > AREA.Min.y && WORLD.PositionY[i] - WORLD.HalfY[i] < AREA.Max.y &&
+                     WORLD.PositionZ[i] + WORLD.HalfZ[i] > AREA.Min.z && WORLD.PositionZ[i] - WORLD.HalfZ[i] < AREA.Max.z;
+
+        if (!INSIDE) continue;
+
+        EXPECTED++;
+
+        int LISTED = 0;
+        for (int k=0; k < COUNT; k++) LISTED |= FOUND[k] == WORLD.Handle[i];
+
+        if (!LISTED) MISMATCHED++;
+    }
+
+    printf("%d bodies after %d steps: %d below the floor, %d NaN, fastest at %.2f\n", BODIES, STEPS, SUNK, INVALID, FASTEST);
+    printf("Handles wrong after destroying half: %d\n", WRONG);
+    printf("Query found %d bodies, %d expected, %d missing (floor %s)\n", COUNT, EXPECTED, MISMATCHED, Jubi_GetBodyIndex3D(&WORLD, FLOOR) >= 0 ? "kept" : "lost");
+    printf("%.1f us per step, %d KB world\n", STEP_US, (int)(sizeof(JubiWorld3D) / 1024));
+
+    int PASSED = SUNK == 0 && INVALID == 0 && FASTEST < 2.0f && WRONG == 0 && COUNT == EXPECTED && MISMATCHED == 0 && COUNT > 1 && WORLD.BodyCount == BODIES / 2 + 1;
+
+    Jubi_DestroyWorld3D(&WORLD);
+
+    return PASSED ? 0 : 1;
+}
+/*
+
+All source code & software are available under the MIT license:
+    MIT License
+
+    Copyright (c) 2025 Averi
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+
+*/
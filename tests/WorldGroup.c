@@ -0,0 +1,176 @@
+/*
+===========================================================
+                     TEST INFORMATION
+
+TEST NAME: WorldGroup.c
+CREATION DATE: 26/10/18 | International Date Format
+LAST MODIFIED: 26/10/18 | International Date Format
+
+===========================================================
+                      TEST PURPOSE
+
+This test is to check that stepping many worlds together
+on a thread pool gives the same result as stepping each of
+them on its own. Two identical sets of worlds, all with a
+different amount of boxes, are stepped both ways & compared.
+The first few worlds also carry more particles than fit in
+one particle task, so they're split up while grouped too.
+Tasks that start their own parallel work from inside a pool
+task are checked too, those used to wait on the pool forever.
+
+If working correctly, the program should say that every
+world matches & that every nested task ran once.
+
+===========================================================
+                   LICENSE INFORMATION
+
+The following software is protected under the MIT license.
+More detailed information is present at the root LICENSE
+file AND OR the end of the file.
+
+===========================================================
+*/
+
+#define JUBI_ENABLE_THREADS
+#define JUBI_IMPLEMENTATION
+#include "../Jubi.h"
+
+#include <stdio.h>
+
+#define WORLD_COUNT 16
+
+static JubiWorld2D GROUPED[WORLD_COUNT];
+static JubiWorld2D SOLO[WORLD_COUNT];
+
+#define PARTICLE_WORLDS 4
+#define PARTICLE_COUNT 40000 // Over JUBI_PARTICLE_TASK_SIZE
+
+static Vector2 POSITIONS[PARTICLE_COUNT];
+static Vector2 VELOCITIES[PARTICLE_COUNT];
+
+static void FillWorld(JubiWorld2D *WORLD, int SEED) {
+    *WORLD = Jubi_CreateWorld2D();
+
+    JBody2D_CreateBox(WORLD, (Vector2){0, 20}, (Vector2){200, 2}, BODY_STATIC, 0.0f);
+
+    // Uneven worlds, so the group has something to balance
+    for (int i=0; i < 20 + SEED * 25; i++)
+        JBody2D_CreateBox(WORLD, (Vector2){(float)(i % 30) * 1.5f - 20.0f, (float)(i / 30) * 1.5f - (float)SEED}, (Vector2){1.4f, 1.4f}, BODY_DYNAMIC, 1.0f);
+
+    if (SEED < PARTICLE_WORLDS) {
+        for (int i=0; i < PARTICLE_COUNT; i++) {
+            POSITIONS[i] = (Vector2){(float)(i % 400) * 0.25f - 50.0f, (float)(i / 400) * 0.05f - 10.0f};
+            VELOCITIES[i] = (Vector2){(float)((i * 7) % 13) - 6.0f, -(float)((i * 3) % 11) - (float)SEED};
+        }
+
+        Jubi_EmitParticles2D(WORLD, POSITIONS, VELOCITIES, PARTICLE_COUNT, 0.0f);
+    }
+}
+
+#define OUTER_TASKS 8
+#define INNER_TASKS 64
+
+static int NESTED_RUNS[OUTER_TASKS][INNER_TASKS];
+
+static void InnerTask(void *DATA, int INDEX) {
+    int *RUNS = (int *)DATA;
+
+    RUNS[INDEX]++;
+}
+
+// Runs its own task list, the way a grouped world solves its joints
+static void OuterTask(void *DATA, int INDEX) {
+    (void)DATA;
+
+    Jubi__RunTasks(InnerTask, NESTED_RUNS[INDEX], INNER_TASKS);
+}
+
+int main() {
+    JubiWorld2D *POINTERS[WORLD_COUNT];
+
+    for (int i=0; i < WORLD_COUNT; i++) {
+        FillWorld(&GROUPED[i], i);
+        FillWorld(&SOLO[i], i);
+
+        POINTERS[i] = &GROUPED[i];
+    }
+
+    JubiThreadPool *POOL = Jubi_CreateThreadPool(3);
+    JubiScheduler SCHEDULER = Jubi_ThreadPoolScheduler(POOL);
+    Jubi_SetScheduler(&SCHEDULER);
+
+    JubiWorldGroup2D GROUP = Jubi_CreateWorldGroup2D(POINTERS, WORLD_COUNT);
+
+    for (int i=0; i < 300; i++) {
+        Jubi_StepWorldGroup2D(&GROUP, 0.016f);
+
+        for (int j=0; j < WORLD_COUNT; j++)
+            Jubi_StepWorld2D(&SOLO[j], 0.016f);
+    }
+
+    int MISMATCHES = 0;
+
+    for (int i=0; i < WORLD_COUNT; i++) {
+        int SAME = GROUPED[i].BodyCount == SOLO[i].BodyCount && GROUPED[i].StepCount == SOLO[i].StepCount;
+
+        for (int j=0; SAME && j < GROUPED[i].BodyCount; j++)
+            SAME = GROUPED[i].Bodies[j].Position.x == SOLO[i].Bodies[j].Position.x && GROUPED[i].Bodies[j].Position.y == SOLO[i].Bodies[j].Position.y;
+
+        SAME = SAME && GROUPED[i].Particles.Count == SOLO[i].Particles.Count;
+
+        for (int j=0; SAME && j < GROUPED[i].Particles.Count; j++)
+            SAME = GROUPED[i].Particles.X[j] == SOLO[i].Particles.X[j] && GROUPED[i].Particles.Y[j] == SOLO[i].Particles.Y[j];
+
+        printf("World %2d (%4d bodies, %5d particles): %s\n", i, GROUPED[i].BodyCount, GROUPED[i].Particles.Count, SAME ? "Matches" : "DIFFERS");
+
+        MISMATCHES += !SAME;
+    }
+
+    Jubi__RunTasks(OuterTask, NULL, OUTER_TASKS);
+
+    int NESTED_MISSES = 0;
+
+    for (int i=0; i < OUTER_TASKS; i++)
+        for (int j=0; j < INNER_TASKS; j++)
+            NESTED_MISSES += NESTED_RUNS[i][j] != 1;
+
+    printf("Pool threads: %d, Mismatched worlds: %d, Nested tasks not run once: %d\n", POOL -> ThreadCount, MISMATCHES, NESTED_MISSES);
+
+    Jubi_SetScheduler(NULL);
+    Jubi_DestroyWorldGroup2D(&GROUP);
+    Jubi_DestroyThreadPool(POOL);
+
+    for (int i=0; i < WORLD_COUNT; i++) {
+        Jubi_DestroyWorld2D(&GROUPED[i]);
+        Jubi_DestroyWorld2D(&SOLO[i]);
+    }
+
+    return MISMATCHES == 0 && NESTED_MISSES == 0 ? 0 : 1;
+}
+
+/*
+
+All source code & software are available under the MIT license:
+    MIT License
+
+    Copyright (c) 2025 Averi
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+
+*/